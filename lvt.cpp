@@ -1,9 +1,425 @@
 #include <set>
+#include <map>
+#include <deque>
+#include <unordered_map>
+#include <charconv>
+#include <atomic>
+#include <array>
+#include <cerrno>
+#include <system_error>
+#include <mutex>
+#include <condition_variable>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <dirent.h>
+#include <sys/inotify.h>
+#include <malloc.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include <unistd.h>
 
 #include "lvt.hpp"
 
 using namespace lvt;
 
+void lvt::print::Output::write(std::string_view data) const
+{
+    if (data.empty())
+        return;
+
+    if (auto const fd{std::get_if<int>(&m_target)})
+    {
+        for (size_t done{}; done < data.size();)
+        {
+            ssize_t const n{::write(*fd, data.data() + done, data.size() - done)};
+            if (n > 0)
+                done += static_cast<size_t>(n);
+            else if (n == -1 && errno == EINTR)
+                continue;
+            else
+                throw std::system_error(errno, std::generic_category(), "print: write() failed");
+        }
+    }
+    else if (auto const file{std::get_if<std::FILE *>(&m_target)})
+    {
+        if (std::fwrite(data.data(), 1ul, data.size(), *file) != data.size())
+            throw std::system_error(errno, std::generic_category(), "print: fwrite() failed");
+    }
+    else if (auto const os{std::get_if<std::ostream *>(&m_target)})
+        (*os)->write(data.data(), static_cast<std::streamsize>(data.size()));
+    else
+        std::get<std::string *>(m_target)->append(data);
+}
+
+// Buffer of the last finished 'Writer' of the thread, so the next print call doesn't allocate.
+// Nested writers (e.g. 'operator<<' that prints by itself) get a new buffer
+static thread_local std::string t_printBuffer;
+
+// Capacity above which the buffer isn't kept for the next calls
+static constexpr size_t kMaxCachedPrintBuffer{lvt::print::Writer::kFlushThreshold * 2ul};
+
+// Stream for the types printed only by 'operator<<', appends directly to the buffer of the writer
+struct lvt::print::Writer::StreamAdapter : std::streambuf
+{
+    std::string &buffer;
+    std::ostream os;
+
+    explicit StreamAdapter(std::string &buf) : buffer(buf), os(this) {}
+
+    int_type overflow(int_type ch) override
+    {
+        if (!traits_type::eq_int_type(ch, traits_type::eof()))
+            buffer.push_back(traits_type::to_char_type(ch));
+        return traits_type::not_eof(ch);
+    }
+
+    std::streamsize xsputn(char const *s, std::streamsize count) override
+    {
+        buffer.append(s, static_cast<size_t>(count));
+        return count;
+    }
+};
+
+lvt::print::Writer::Writer(Output output) : m_output(output), m_buffer(std::move(t_printBuffer))
+{
+    t_printBuffer.clear();
+    m_buffer.clear();
+}
+
+lvt::print::Writer::~Writer()
+{
+    if (m_buffer.capacity() <= kMaxCachedPrintBuffer && m_buffer.capacity() > t_printBuffer.capacity())
+        t_printBuffer = std::move(m_buffer);
+}
+
+std::ostream &lvt::print::Writer::stream()
+{
+    if (!m_stream)
+        m_stream = std::make_unique<StreamAdapter>(m_buffer);
+    return m_stream->os;
+}
+
+void lvt::print::Writer::flush()
+{
+    // Buffer is cleared even if the write throws, so the text isn't written twice
+    try
+    {
+        m_output.write(m_buffer);
+    }
+    catch (...)
+    {
+        m_buffer.clear();
+        throw;
+    }
+    m_buffer.clear();
+}
+
+namespace
+{
+    // States of the number automaton, 'Reject' is the trap state
+    enum NumberState : std::uint8_t
+    {
+        Start,
+        Sign,
+        Zero,      // Leading '0': may start the hex prefix
+        Integer,
+        IntegerSep,
+        Point,     // '.' without digits before it
+        Fraction,  // After '.' that follows the digits, or after digits of the fraction
+        FractionSep,
+        ExpStart,
+        ExpSign,
+        Exponent,
+        ExponentSep,
+        HexPrefix,
+        HexDigits,
+        HexSep,
+        Reject,
+        kNumberStates
+    };
+
+    enum CharClass : std::uint8_t
+    {
+        ZeroDigit,
+        Digit,
+        HexLetter, // a-f and A-F except 'e'/'E'
+        ExpLetter,
+        XLetter,
+        Plus,
+        Minus,
+        Dot,
+        Underscore,
+        Other,
+        kCharClasses
+    };
+
+    using NumberTable = std::array<std::array<NumberState, kCharClasses>, kNumberStates>;
+
+    constexpr NumberTable makeNumberTable()
+    {
+        NumberTable table{};
+        for (auto &row : table)
+            row.fill(Reject);
+
+        auto const digits{[&table](NumberState from, NumberState to)
+                          { table[from][ZeroDigit] = table[from][Digit] = to; }};
+        auto const hexDigits{[&table, &digits](NumberState from, NumberState to)
+                             {
+                                 digits(from, to);
+                                 table[from][HexLetter] = table[from][ExpLetter] = to;
+                             }};
+
+        table[Start][Plus] = table[Start][Minus] = Sign;
+        for (NumberState const from : {Start, Sign})
+        {
+            table[from][ZeroDigit] = Zero;
+            table[from][Digit] = Integer;
+            table[from][Dot] = Point;
+        }
+
+        for (NumberState const from : {Zero, Integer})
+        {
+            digits(from, Integer);
+            table[from][Underscore] = IntegerSep;
+            table[from][Dot] = Fraction;
+            table[from][ExpLetter] = ExpStart;
+        }
+        table[Zero][XLetter] = HexPrefix;
+        digits(IntegerSep, Integer);
+
+        digits(Point, Fraction);
+        digits(Fraction, Fraction);
+        table[Fraction][Underscore] = FractionSep;
+        table[Fraction][ExpLetter] = ExpStart;
+        digits(FractionSep, Fraction);
+
+        table[ExpStart][Plus] = table[ExpStart][Minus] = ExpSign;
+        digits(ExpStart, Exponent);
+        digits(ExpSign, Exponent);
+        digits(Exponent, Exponent);
+        table[Exponent][Underscore] = ExponentSep;
+        digits(ExponentSep, Exponent);
+
+        hexDigits(HexPrefix, HexDigits);
+        hexDigits(HexDigits, HexDigits);
+        table[HexDigits][Underscore] = HexSep;
+        hexDigits(HexSep, HexDigits);
+        return table;
+    }
+
+    constexpr NumberTable kNumberTable{makeNumberTable()};
+
+    // Classes of the characters for every combination of the optional syntax: disabled parts are 'Other'
+    constexpr std::array<std::array<CharClass, 256ul>, 4ul> makeCharClasses()
+    {
+        std::array<std::array<CharClass, 256ul>, 4ul> classes{};
+        for (size_t options{}; options < classes.size(); ++options)
+        {
+            bool const hex{(options & 1ul) != 0ul}, separators{(options & 2ul) != 0ul};
+            auto &map{classes[options]};
+            map.fill(Other);
+            map['0'] = ZeroDigit;
+            for (char ch{'1'}; ch <= '9'; ++ch)
+                map[static_cast<unsigned char>(ch)] = Digit;
+            map['e'] = map['E'] = ExpLetter;
+            map['+'] = Plus;
+            map['-'] = Minus;
+            map['.'] = Dot;
+            if (hex)
+            {
+                for (char ch : {'a', 'b', 'c', 'd', 'f', 'A', 'B', 'C', 'D', 'F'})
+                    map[static_cast<unsigned char>(ch)] = HexLetter;
+                map['x'] = map['X'] = XLetter;
+            }
+            if (separators)
+                map['_'] = Underscore;
+        }
+        return classes;
+    }
+
+    constexpr auto kCharClassMaps{makeCharClasses()};
+
+    // Kind of the number that ends in the state, signed integers are distinguished by the sign afterwards
+    constexpr std::array<checkings::NumberKind, kNumberStates> makeAcceptedKinds()
+    {
+        std::array<checkings::NumberKind, kNumberStates> kinds{};
+        kinds[Zero] = kinds[Integer] = checkings::NumberKind::Unsigned;
+        kinds[Fraction] = checkings::NumberKind::Decimal;
+        kinds[Exponent] = checkings::NumberKind::Scientific;
+        kinds[HexDigits] = checkings::NumberKind::Hex;
+        return kinds;
+    }
+
+    constexpr auto kAcceptedKinds{makeAcceptedKinds()};
+
+    constexpr unsigned hexValue(char ch) noexcept
+    {
+        return ch <= '9' ? static_cast<unsigned>(ch - '0') : static_cast<unsigned>((ch | 0x20) - 'a' + 10);
+    }
+}
+
+// Runs the automaton, fills everything except the value of the floating point numbers
+static checkings::NumberToken scanNumber(std::string_view str, checkings::NumberSyntax syntax, bool &separated) noexcept
+{
+    auto const &classes{kCharClassMaps[(syntax.hex ? 1ul : 0ul) | (syntax.separators ? 2ul : 0ul)]};
+
+    checkings::NumberToken token;
+    NumberState state{Start};
+    std::uint64_t magnitude{};
+    bool sign{}, overflow{};
+    separated = false;
+    for (size_t i{}; i < str.size(); ++i)
+    {
+        char const ch{str[i]};
+        NumberState const next{kNumberTable[state][classes[static_cast<unsigned char>(ch)]]};
+        if (next == Reject)
+            break;
+
+        // Only digits of the integers are accumulated, floating point value is converted from the accepted text
+        if (next == Integer || next == HexDigits)
+            overflow |= __builtin_mul_overflow(magnitude, next == Integer ? 10u : 16u, &magnitude) ||
+                        __builtin_add_overflow(magnitude, hexValue(ch), &magnitude);
+        else if (next == Sign)
+        {
+            sign = true;
+            token.negative = ch == '-';
+        }
+        separated |= ch == '_';
+        state = next;
+
+        if (checkings::NumberKind const kind{kAcceptedKinds[state]}; kind != checkings::NumberKind::Invalid)
+        {
+            token.kind = kind;
+            token.length = i + 1ul;
+            token.magnitude = magnitude;
+            token.overflow = overflow;
+        }
+    }
+
+    if (sign && token.kind == checkings::NumberKind::Unsigned)
+        token.kind = checkings::NumberKind::Signed;
+    if (token.kind == checkings::NumberKind::Invalid)
+        token = {};
+    return token;
+}
+
+checkings::NumberToken lvt::checkings::parseNumber(std::string_view str, NumberSyntax syntax) noexcept
+{
+    bool separated;
+    NumberToken token{scanNumber(str, syntax, separated)};
+    if (token.kind == NumberKind::Decimal || token.kind == NumberKind::Scientific)
+    {
+        // 'std::from_chars' doesn't accept '+' and separators
+        std::string_view text{str.substr(0ul, token.length)};
+        if (text.front() == '+')
+            text.remove_prefix(1ul);
+        std::string cleaned;
+        if (separated)
+        {
+            std::ranges::copy_if(text, std::back_inserter(cleaned), [](char ch)
+                                 { return ch != '_'; });
+            text = cleaned;
+        }
+        auto const [ptr, ec]{std::from_chars(text.data(), text.data() + text.size(), token.value)};
+        token.overflow = ec == std::errc::result_out_of_range;
+        token.magnitude = 0ull;
+    }
+    else if (token.kind != NumberKind::Invalid)
+        token.value = token.negative ? -static_cast<double>(token.magnitude) : static_cast<double>(token.magnitude);
+    return token;
+}
+
+// Bit per byte of the 16-byte block that isn't a decimal digit
+static unsigned nonDigitMask(char const *block) noexcept
+{
+#ifdef __SSE2__
+    // Bytes above 0x7F are negative, so they are below '0' too
+    __m128i const chunk{_mm_loadu_si128(reinterpret_cast<__m128i const *>(block))};
+    return static_cast<unsigned>(_mm_movemask_epi8(_mm_or_si128(_mm_cmplt_epi8(chunk, _mm_set1_epi8('0')),
+                                                                _mm_cmpgt_epi8(chunk, _mm_set1_epi8('9')))));
+#else
+    unsigned mask{};
+    for (unsigned i{}; i < 16u; ++i)
+        mask |= static_cast<unsigned>(static_cast<unsigned char>(block[i] - '0') >= 10u) << i;
+    return mask;
+#endif
+}
+
+// Kind of "[-]digits" and "[-]digits.digits" (the most common fields) checked by 16 bytes at a time,
+// 'NumberKind::Invalid' if the string needs the automaton
+static checkings::NumberKind plainNumberKind(std::string_view str) noexcept
+{
+    bool minus{}, point{};
+    for (size_t offset{}; offset < str.size(); offset += 16ul)
+    {
+        unsigned mask;
+        if (str.size() - offset >= 16ul)
+            mask = nonDigitMask(str.data() + offset);
+        else
+        {
+            // Tail is copied, so the load doesn't cross the end of the string
+            std::array<char, 16ul> tail;
+            tail.fill('0');
+            std::memcpy(tail.data(), str.data() + offset, str.size() - offset);
+            mask = nonDigitMask(tail.data());
+        }
+
+        for (; mask != 0u; mask &= mask - 1u)
+        {
+            size_t const pos{offset + static_cast<size_t>(std::countr_zero(mask))};
+            if (pos == 0ul && str[pos] == '-')
+                minus = true;
+            else if (str[pos] == '.' && !point)
+                point = true;
+            else
+                return checkings::NumberKind::Invalid;
+        }
+    }
+
+    if (str.size() <= (minus ? 1ul : 0ul) + (point ? 1ul : 0ul))
+        return checkings::NumberKind::Invalid;
+    return point ? checkings::NumberKind::Decimal : (minus ? checkings::NumberKind::Signed : checkings::NumberKind::Unsigned);
+}
+
+checkings::NumberKind lvt::checkings::classifyNumber(std::string_view str, NumberSyntax syntax) noexcept
+{
+    if (NumberKind const kind{plainNumberKind(str)}; kind != NumberKind::Invalid)
+        return kind;
+
+    bool separated;
+    NumberToken const token{scanNumber(str, syntax, separated)};
+    return token.length == str.size() ? token.kind : NumberKind::Invalid;
+}
+
+std::vector<checkings::NumberKind> lvt::checkings::classifyNumbers(std::span<std::string_view const> fields, NumberSyntax syntax)
+{
+    std::vector<NumberKind> kinds(fields.size());
+    std::ranges::transform(fields, kinds.begin(), [syntax](std::string_view field)
+                           { return classifyNumber(field, syntax); });
+    return kinds;
+}
+
+bool lvt::checkings::is_uint_number(const std::string &str)
+{
+    return classifyNumber(str) == NumberKind::Unsigned;
+}
+
+bool lvt::checkings::is_int_number(const std::string &str)
+{
+    NumberKind const kind{classifyNumber(str)};
+    return kind == NumberKind::Unsigned || kind == NumberKind::Signed;
+}
+
+bool lvt::checkings::is_floating_number(const std::string &str)
+{
+    NumberKind const kind{classifyNumber(str)};
+    return kind != NumberKind::Invalid && kind != NumberKind::Hex;
+}
+
 bool lvt::checkings::is_vowel(char __ch)
 {
     return (__ch == 'a' || __ch == 'e' || __ch == 'i' || __ch == 'o' ||
@@ -18,36 +434,110 @@ bool lvt::checkings::isBracketSequenceValid(std::string_view seq)
     // Check boundary condition
     if (seq.empty())
         return false;
+    return !findBracketError(seq);
+}
+
+// Bit per bracket byte of the 64-byte block
+static std::uint64_t bracketMask(char const *block) noexcept
+{
+#ifdef __SSE2__
+    // '(' and ')' differ only in the lowest bit, '[' and '{' (as ']' and '}') only in 0x20
+    auto const brackets{[](char const *p)
+                        {
+                            __m128i const chunk{_mm_loadu_si128(reinterpret_cast<__m128i const *>(p))};
+                            __m128i const round{_mm_cmpeq_epi8(_mm_and_si128(chunk, _mm_set1_epi8(static_cast<char>(0xFE))), _mm_set1_epi8('('))};
+                            __m128i const folded{_mm_and_si128(chunk, _mm_set1_epi8(static_cast<char>(0xDF)))};
+                            return _mm_or_si128(round, _mm_or_si128(_mm_cmpeq_epi8(folded, _mm_set1_epi8('[')), _mm_cmpeq_epi8(folded, _mm_set1_epi8(']'))));
+                        }};
+    __m128i const b0{brackets(block)}, b1{brackets(block + 16)}, b2{brackets(block + 32)}, b3{brackets(block + 48)};
+
+    // Most of the blocks have no brackets, they need only one 'movemask'
+    if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(b0, b1), _mm_or_si128(b2, b3))) == 0)
+        return 0ull;
+    auto const bits{[](__m128i v)
+                    { return static_cast<std::uint64_t>(static_cast<unsigned>(_mm_movemask_epi8(v))); }};
+    return bits(b0) | (bits(b1) << 16u) | (bits(b2) << 32u) | (bits(b3) << 48u);
+#else
+    std::uint64_t mask{};
+    for (unsigned i{}; i < 64u; ++i)
+    {
+        char const ch{block[i]};
+        bool const bracket{ch == '(' || ch == ')' || ch == '[' || ch == ']' || ch == '{' || ch == '}'};
+        mask |= static_cast<std::uint64_t>(bracket) << i;
+    }
+    return mask;
+#endif
+}
 
-    // Storing brackets in the stack adapter
-    std::stack<char> brackets;
-    for (char ch : seq)
+bool lvt::checkings::BracketValidator::step(char ch, size_t offset)
+{
+    if (ch == '(' || ch == '[' || ch == '{')
     {
-        // Pushing back opening bracket
-        if (ch == '(' || ch == '[' || ch == '{')
-            brackets.push(ch);
-        // Pushing back closing bracket
+        // Expected closing bracket is stored: ')' follows '(', ']' and '}' are 2 after '[' and '{'
+        char const closing{static_cast<char>(ch == '(' ? ')' : ch + 2)};
+        if (m_depth < kInlineDepth)
+            m_inline[m_depth] = closing;
         else
+            m_spill.push_back(closing);
+        ++m_depth;
+    }
+    else if (ch == ')' || ch == ']' || ch == '}')
+    {
+        char const expected{m_depth == 0ul ? '\0' : (m_depth > kInlineDepth ? m_spill.back() : m_inline[m_depth - 1ul])};
+        if (expected != ch)
         {
-            // If stack is empty
-            if (brackets.empty())
-                return false;
+            m_error = offset;
+            return false;
+        }
+        if (m_depth-- > kInlineDepth)
+            m_spill.pop_back();
+    }
+    return true;
+}
 
-            // Storing the top element from the stack
-            char top{brackets.top()};
+bool lvt::checkings::BracketValidator::feed(std::string_view chunk)
+{
+    if (m_error)
+        return false;
 
-            // If we have enclosing brackets (pair of opening and closing bracket)
-            // -> erase top element from the stack
-            if ((top == '(' && ch == ')') || (top == '[' && ch == ']') || (top == '{' && ch == '}'))
-                brackets.pop();
-            // Else there is no enclosing pair -> balance is broken
-            else
+    size_t const base{m_offset};
+    m_offset += chunk.size();
+
+    // Only positions of the brackets are visited in the blocks of 64 bytes
+    size_t pos{};
+    for (; chunk.size() - pos >= 64ul; pos += 64ul)
+        for (std::uint64_t mask{bracketMask(chunk.data() + pos)}; mask != 0ull; mask &= mask - 1ull)
+        {
+            size_t const at{pos + static_cast<size_t>(std::countr_zero(mask))};
+            if (!step(chunk[at], base + at))
                 return false;
         }
-    }
+    for (; pos < chunk.size(); ++pos)
+        if (!step(chunk[pos], base + pos))
+            return false;
+    return true;
+}
+
+bool lvt::checkings::BracketValidator::finish() noexcept
+{
+    if (!m_error && m_depth != 0ul)
+        m_error = m_offset;
+    return !m_error;
+}
+
+void lvt::checkings::BracketValidator::reset() noexcept
+{
+    m_spill.clear();
+    m_depth = m_offset = 0ul;
+    m_error.reset();
+}
 
-    // If stack is empty - all is OK, otherwise - balance is broken
-    return brackets.empty();
+std::optional<size_t> lvt::checkings::findBracketError(std::string_view seq)
+{
+    BracketValidator validator;
+    validator.feed(seq);
+    validator.finish();
+    return validator.errorOffset();
 }
 
 std::string string::modifying::str_to_lower(const std::string &__str)
@@ -167,41 +657,234 @@ int lvt::string::lengthOfLongestSubstring(std::string_view s)
     return maxLen;
 }
 
-double lvt::random::create_random_double(const double &__lower, const double &__upper)
+// Bit per whitespace byte of the 16-byte block
+static unsigned whitespaceMask(char const *block) noexcept
 {
-    return __lower + (static_cast<double>(rand()) / RAND_MAX) * (__upper - __lower);
+#ifdef __SSE2__
+    __m128i const chunk{_mm_loadu_si128(reinterpret_cast<__m128i const *>(block))};
+    __m128i const control{_mm_and_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8('\t' - 1)), _mm_cmplt_epi8(chunk, _mm_set1_epi8('\r' + 1)))};
+    return static_cast<unsigned>(_mm_movemask_epi8(_mm_or_si128(control, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(' ')))));
+#else
+    unsigned mask{};
+    for (unsigned i{}; i < 16u; ++i)
+        mask |= static_cast<unsigned>(convert::detail::isSpace(block[i])) << i;
+    return mask;
+#endif
 }
 
-std::string lvt::random::generateRandomString(size_t __lenght)
+// Returns the first character in [first, last) that is whitespace ('whitespace' is true) or isn't, 'last' if there is none
+static char const *findSpaceOrNot(char const *first, char const *last, bool whitespace) noexcept
 {
-#ifdef __GENERATE__ALL__SYMBOLS__
-    static constexpr char symbols[]{"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz`1234567890-=~!@#$%^&*()_+[]{}\\|/\'\",.<>:; "};
-#endif
+    unsigned const flip{whitespace ? 0u : 0xFFFFu};
+    for (; last - first >= 16; first += 16)
+        if (unsigned const mask{whitespaceMask(first) ^ flip}; mask != 0u)
+            return first + std::countr_zero(mask);
+    while (first != last && convert::detail::isSpace(*first) != whitespace)
+        ++first;
+    return first;
+}
 
-#ifdef __GENERATE__ONLY__DIGITS__
-    static constexpr char onlyDigits[]{"1234567890"};
-#endif
+struct lvt::input::Reader::Impl
+{
+    int fd{-1};
+    std::istream *is{};
+    std::unique_ptr<char[]> storage;
+    size_t capacity{};
+
+    // Unread data is [pos, end) of the storage or of the memory given to 'fromMemory()'
+    char const *base{}, *pos{}, *end{};
+    size_t baseOffset{}; // Offset of 'base' from the beginning of the input
+    bool eof{};
+    int error{};
+
+    Impl(size_t bufferSize) : storage(std::make_unique_for_overwrite<char[]>(std::max(bufferSize, 64ul))),
+                              capacity(std::max(bufferSize, 64ul)), base(storage.get()), pos(base), end(base) {}
+    Impl(std::string_view data) : base(data.data()), pos(base), end(base + data.size()), eof(true) {}
+
+    /**
+     * @brief Moves unread data to the beginning of the buffer (growing it if it's full) and appends the next block
+     * @return false if nothing was read (end of the input or error)
+     */
+    bool refill()
+    {
+        if (eof || error != 0)
+            return false;
+
+        size_t const unread{static_cast<size_t>(end - pos)};
+        baseOffset += static_cast<size_t>(pos - base);
+        if (unread == capacity)
+        {
+            auto grown{std::make_unique_for_overwrite<char[]>(capacity * 2ul)};
+            std::memcpy(grown.get(), pos, unread);
+            storage = std::move(grown);
+            capacity *= 2ul;
+        }
+        else
+            std::memmove(storage.get(), pos, unread);
+        base = pos = storage.get();
+        end = base + unread;
+
+        char *const dst{storage.get() + unread};
+        size_t const room{capacity - unread};
+        size_t got{};
+        if (is != nullptr)
+        {
+            // Only characters that are available without blocking are taken, otherwise interactive input
+            // would be waited for until the buffer is full. Stream without its own buffer (e.g. 'std::cin'
+            // synchronized with stdio) is read by characters up to the end of the line
+            std::streambuf *const buf{is->rdbuf()};
+            auto const takeAvailable{[&]
+                                     {
+                                         std::streamsize const avail{buf->in_avail()};
+                                         if (avail <= 0)
+                                             return false;
+                                         got += static_cast<size_t>(std::max<std::streamsize>(
+                                             buf->sgetn(dst + got, std::min(avail, static_cast<std::streamsize>(room - got))), 0));
+                                         return true;
+                                     }};
+            if (!takeAvailable())
+                for (int ch; got < room && (ch = buf->sbumpc()) != std::char_traits<char>::eof();)
+                {
+                    dst[got++] = static_cast<char>(ch);
+                    if (ch == '\n' || got == room || takeAvailable())
+                        break;
+                }
+            if (got == 0ul)
+                eof = true;
+        }
+        else
+        {
+            while (true)
+            {
+                ssize_t const n{::read(fd, dst, room)};
+                if (n > 0)
+                    got = static_cast<size_t>(n);
+                else if (n == -1 && errno == EINTR)
+                    continue;
+                else if (n == 0)
+                    eof = true;
+                else
+                    error = errno;
+                break;
+            }
+        }
+        end += got;
+        return got != 0ul;
+    }
+};
+
+lvt::input::Reader::Reader(int fd, size_t bufferSize) : m_impl(std::make_unique<Impl>(bufferSize)) { m_impl->fd = fd; }
 
-    // Declaring variable for store random string inside
-    std::string rndmString{};
+lvt::input::Reader::Reader(std::istream &is, size_t bufferSize) : m_impl(std::make_unique<Impl>(bufferSize)) { m_impl->is = &is; }
+
+input::Reader lvt::input::Reader::fromMemory(std::string_view data)
+{
+    Reader reader(-1, 0ul);
+    reader.m_impl = std::make_unique<Impl>(data);
+    return reader;
+}
+
+lvt::input::Reader::Reader(Reader &&) noexcept = default;
+input::Reader &lvt::input::Reader::operator=(Reader &&) noexcept = default;
+lvt::input::Reader::~Reader() = default;
+
+std::expected<std::string_view, input::ReadError> lvt::input::Reader::token()
+{
+    Impl &impl{*m_impl};
+    while ((impl.pos = findSpaceOrNot(impl.pos, impl.end, false)) == impl.end)
+        if (!impl.refill())
+        {
+            if (impl.error != 0)
+                return std::unexpected(ReadError{ReadError::Kind::Io, offset(), {}, impl.error});
+            return std::unexpected(ReadError{ReadError::Kind::EndOfInput, offset(), {}, 0});
+        }
 
-    // Generating random string
-    for (size_t iter = 0; iter < __lenght; iter++)
+    // Token may continue in the next block, already scanned part isn't scanned again
+    size_t scanned{};
+    char const *tokenEnd;
+    while ((tokenEnd = findSpaceOrNot(impl.pos + scanned, impl.end, true)) == impl.end)
     {
-#ifdef __GENERATE__ALL__SYMBOLS__
-        rndmString += symbols[rand() % (sizeof(symbols) - 1)];
-#endif
+        scanned = static_cast<size_t>(impl.end - impl.pos);
+        if (!impl.refill())
+        {
+            if (impl.error != 0)
+                return std::unexpected(ReadError{ReadError::Kind::Io, offset(), {}, impl.error});
+            tokenEnd = impl.end;
+            break;
+        }
+    }
 
-#ifdef __GENERATE__ONLY__DIGITS__
-        rndmString += onlyDigits[rand() % (sizeof(onlyDigits) - 1)];
+    std::string_view const tok(impl.pos, static_cast<size_t>(tokenEnd - impl.pos));
+    impl.pos = tokenEnd;
+    return tok;
+}
 
-        // To avoid numbers like 03, 045 etc.
-        if (rndmString[iter] == '0')
-            rndmString.erase(iter);
-#endif
+input::ReadError lvt::input::Reader::tokenError(std::string_view token, std::errc ec) const
+{
+    size_t const tokenOffset{m_impl->baseOffset + static_cast<size_t>(token.data() - m_impl->base)};
+    return ReadError{ec == std::errc::result_out_of_range ? ReadError::Kind::OutOfRange : ReadError::Kind::Invalid,
+                     tokenOffset, std::string(token), 0};
+}
+
+size_t lvt::input::Reader::offset() const noexcept { return m_impl->baseOffset + static_cast<size_t>(m_impl->pos - m_impl->base); }
+
+// Seed set by 'random::seed()' and count of its calls: thread engines compare it with their own epoch
+static std::atomic<std::uint64_t> g_randomSeed{}, g_randomSeedEpoch{};
+
+// Count of threads that have used 'random::threadEngine()'
+static std::atomic<std::uint64_t> g_randomThreadCount{};
+
+void lvt::random::seed(std::uint64_t value)
+{
+    g_randomSeed.store(value, std::memory_order_relaxed);
+    g_randomSeedEpoch.fetch_add(1ull, std::memory_order_release);
+}
+
+lvt::random::default_engine &lvt::random::threadEngine()
+{
+    struct ThreadState
+    {
+        default_engine engine;
+        std::uint64_t index{g_randomThreadCount.fetch_add(1ull, std::memory_order_relaxed)};
+        std::uint64_t epoch{std::numeric_limits<std::uint64_t>::max()};
+    };
+    thread_local ThreadState state;
+
+    if (std::uint64_t const epoch{g_randomSeedEpoch.load(std::memory_order_acquire)}; epoch != state.epoch)
+    {
+        std::uint64_t seedValue{g_randomSeed.load(std::memory_order_relaxed)};
+        if (epoch == 0ull)
+        {
+            std::random_device device;
+            seedValue = (static_cast<std::uint64_t>(device()) << 32u) | device();
+        }
+
+        // Different threads get unrelated states from the same seed
+        std::uint64_t mix{seedValue ^ (state.index * 0xD1B5'4A32'D192'ED03ull)};
+        state.engine = default_engine(splitmix64(mix));
+        state.epoch = epoch;
     }
+    return state.engine;
+}
+
+double lvt::random::create_random_double(const double &__lower, const double &__upper)
+{
+    return uniform(__lower, __upper);
+}
 
+std::string lvt::random::generateRandomString(size_t __lenght)
+{
+#if defined(__GENERATE__ALL__SYMBOLS__)
+    return generateRandomString<alphabets::symbols>(__lenght);
+#elif defined(__GENERATE__ONLY__DIGITS__)
+    // To avoid numbers like 03, 045 etc. the first digit is never zero
+    std::string rndmString(generateRandomString<alphabets::digits>(__lenght));
+    if (!rndmString.empty())
+        fillRandomString<"123456789">(std::span<char>(rndmString.data(), 1ul));
     return rndmString;
+#else
+    return generateRandomString<alphabets::alnum>(__lenght);
+#endif
 }
 
 std::vector<int> lvt::random::generateRandomIntVector(size_t vecSize, int from, int to)
@@ -209,47 +892,53 @@ std::vector<int> lvt::random::generateRandomIntVector(size_t vecSize, int from,
     // Initializing vector with size 'vecSize'
     std::vector<int> vec(vecSize);
 
-    // Create an instance of an engine
-    std::random_device rdm_device;
-
-    // Specify engine and distribution
-    std::mt19937 engine{rdm_device()};
-
-    // Generating random integer numbers
-    std::uniform_int_distribution<int> dist{from, to};
-    std::generate(std::begin(vec), std::end(vec), [&dist, &engine]()
-                  { return dist(engine); });
-
+    // Generating random integer numbers with engine of the current thread
+    fill_uniform(std::span<int>(vec), from, to);
     return vec;
 }
 
 std::vector<std::vector<int>> lvt::random::generateRandomIntMatrix(size_t rows, size_t cols,
                                                                    int offset, int range)
 {
-    srand(std::time(nullptr));
-
     // Allocating necessary memory for matrix
     std::vector<std::vector<int>> matrix(rows, std::vector<int>(cols));
-    for (size_t row{}; row < rows; row++)
-        for (size_t col{}; col < cols; col++)
-            matrix.at(row).at(col) = offset + (rand() % range);
+
+    // Unbiased numbers from [offset; offset + range - 1], engine of the current thread isn't reseeded between calls
+    for (auto &row : matrix)
+        fill_uniform(std::span<int>(row), offset, offset + range - 1);
     return matrix;
 }
 
 void lvt::random::fillVector(std::vector<int> &v, int from, int to)
 {
-    std::random_device seeder;
+    // Engine of the current thread is created and seeded only once
+    fill_uniform(std::span<int>(v), from, to);
+}
 
-    // If "std::random_device" doesn't have an entropy -> using old C-style seed
-    // represented as a current time in "unsigned long" representation
-    // Otherwise call the ctor of the "std::random_device" instance
-    const auto seed{seeder.entropy() ? seeder() : std::time(nullptr)};
+std::string lvt::random::generateRandomString(size_t length, std::string_view alphabet, std::uint64_t seed,
+                                             unsigned threads)
+{
+    if (alphabet.empty())
+        throw std::invalid_argument("random::generateRandomString(): alphabet is empty");
 
-    // Using Mersene twister engine as generator of integer numbers
-    std::mt19937 engine{static_cast<std::mt19937::result_type>(seed)};
-    std::uniform_int_distribution<int> uid{from, to};
-    auto generator{std::bind(uid, engine)};
-    std::generate(std::begin(v), std::end(v), generator);
+    // Indices of the symbols are generated in place of the symbols themselves
+    std::string str(length, '\0');
+    std::span<unsigned char> indices(reinterpret_cast<unsigned char *>(str.data()), str.size());
+    if (alphabet.size() <= 256ul)
+    {
+        fill_uniform_parallel(indices, static_cast<unsigned char>(0u), static_cast<unsigned char>(alphabet.size() - 1ul), seed, threads);
+        std::ranges::transform(indices, str.begin(), [alphabet](unsigned char i)
+                               { return alphabet[i]; });
+    }
+    else
+    {
+        // Alphabet with repeated symbols may be longer than 256
+        std::vector<size_t> wide(length);
+        fill_uniform_parallel(std::span<size_t>(wide), 0ul, alphabet.size() - 1ul, seed, threads);
+        std::ranges::transform(wide, str.begin(), [alphabet](size_t i)
+                               { return alphabet[i]; });
+    }
+    return str;
 }
 
 std::vector<std::string> algorithm::split_str(const std::string &__str, const std::string &__delimiter)
@@ -526,40 +1215,33 @@ int lvt::algorithm::calculateIntervalsLength(std::vector<std::pair<int, int>> in
 
 std::vector<std::string> lvt::algorithm::stringPermutations(std::string s)
 {
-    // Checking of string
-    if (s.empty())
-        return {""};
-
-    std::vector<std::string> perms;
-
-    // Sorting copy of the string to create permutations
-    std::sort(std::begin(s), std::end(s));
-
-    do
-    {
-        // Adding next permutation
-        perms.push_back(s);
+    // Sorting copy of the string and generating permutations lazily one by one
+    permutations_view<std::string> const perms(std::move(s));
 
-        // Checking condition after inserting
-    } while (std::next_permutation(std::begin(s), std::end(s)));
-
-    // Returning result as a vector from unordered set
-    return perms;
+    // Gathering all permutations (for empty string - vector with empty string)
+    std::vector<std::string> result;
+    std::ranges::copy(perms, std::back_inserter(result));
+    return result;
 }
 
 std::vector<int> lvt::algorithm::tribonacci(std::vector<int> signature, int n)
 {
     // Checking bounds
-    if (signature.empty() || signature.size() < 3ul)
+    if (signature.empty() || signature.size() < 3ul || n < 0)
         return {};
 
     // Checking if 'n' is less ore equals than size of the passed sequence
     if (static_cast<size_t>(n) <= signature.size())
+    {
         signature.resize(n);
+        return signature;
+    }
 
-    // Getting new values from Tribonacci sequence
-    for (int i{3ul}; i < n; i++)
-        signature.emplace_back(signature.at(i - 1) + signature.at(i - 2) + signature.at(i - 3));
+    // Getting new values from Tribonacci sequence right after passed ones
+    size_t const initSize{signature.size()};
+    signature.resize(n);
+    for (size_t i{initSize}; i < signature.size(); i++)
+        signature[i] = signature[i - 1] + signature[i - 2] + signature[i - 3];
 
     return signature;
 }
@@ -614,6 +1296,19 @@ std::vector<std::string> lvt::algorithm::extractNonEmptyDirs(std::vector<std::st
     return std::vector<std::string>(std::cbegin(s), std::cend(s));
 }
 
+// Converts map of the n-grams to vector sorted by frequencies, equal frequencies are sorted lexicographically
+static std::vector<std::pair<std::string, int>> sortNGramFrequencies(std::map<std::string, int, std::less<>> const &m)
+{
+    // Initializing vector of pairs with values from the map
+    std::vector<std::pair<std::string, int>> v(std::cbegin(m), std::cend(m));
+
+    // Sorting by frequency of the keys
+    std::sort(std::begin(v), std::end(v), [](auto const &pair1, auto const &pair2)
+              { return std::tie(pair2.second, pair1.first) <
+                       std::tie(pair1.second, pair2.first); });
+    return v;
+}
+
 std::vector<std::pair<std::string, int>> lvt::algorithm::calculateNGramFrequencies(std::vector<std::string> const &words,
                                                                                    size_t lengthOfNGramm)
 {
@@ -621,186 +1316,3003 @@ std::vector<std::pair<std::string, int>> lvt::algorithm::calculateNGramFrequenci
     if (words.empty())
         return {};
 
-    std::map<std::string, int> m;
+    std::map<std::string, int, std::less<>> m;
     for (auto const &word : words)
         // Adding specified by condition length of the word ('n') to the map
         for (size_t j{lengthOfNGramm}; j <= word.length(); ++j)
             ++m[word.substr(j - lengthOfNGramm, lengthOfNGramm)];
+    return sortNGramFrequencies(m);
+}
 
-    // Initializing vector of pairs with values from the map
-    std::vector<std::pair<std::string, int>> v(std::cbegin(m), std::cend(m));
+lvt::BigInt::BigInt(uint128_t value) noexcept
+{
+    m_inline[0] = static_cast<limb_t>(value);
+    m_inline[1] = static_cast<limb_t>(value >> 64u);
+    m_size = 2ul;
+    normalize();
+}
 
-    // Sorting by frequency of the keys
-    std::sort(std::begin(v), std::end(v), [](auto const &pair1, auto const &pair2)
-              { return std::tie(pair2.second, pair1.first) <
-                       std::tie(pair1.second, pair2.first); });
-    return v;
+lvt::BigInt::BigInt(int128_t value) noexcept : BigInt(value < 0 ? uint128_t{} - static_cast<uint128_t>(value)
+                                                                 : static_cast<uint128_t>(value))
+{
+    m_negative = value < 0;
 }
 
-// Calculates sum of 2 big numbers represented as array of integer
-void big_numbers::sum(const std::vector<int> &num1, const std::vector<int> &num2, std::vector<int> &res)
+lvt::BigInt::BigInt(std::string_view str)
 {
-    size_t pos{num1.size() - 1UL};
-    int carry{0};
-    while (pos not_eq 0)
+    bool const negative{!str.empty() && str.front() == '-'};
+    if (!str.empty() && (str.front() == '-' || str.front() == '+'))
+        str.remove_prefix(1ul);
+    if (str.empty() || !std::ranges::all_of(str, [](char ch)
+                                            { return ch >= '0' && ch <= '9'; }))
+        throw std::invalid_argument("BigInt: string is not a decimal number");
+
+    constexpr size_t kChunkDigits{19ul}, kBaseCaseDigits{kChunkDigits * 32ul};
+    constexpr limb_t kChunkBase{10'000'000'000'000'000'000ull};
+
+    // Base case: x = x * 10^19 + chunk, O(n^2) on limbs but with small constant
+    auto const parseSimple{[](std::string_view digits)
+                           {
+                               BigInt res;
+                               size_t const head{digits.size() % kChunkDigits};
+                               for (size_t pos{}; pos < digits.size();)
+                               {
+                                   size_t const len{(pos == 0ul && head != 0ul) ? head : kChunkDigits};
+                                   limb_t chunk{}, scale{1ull};
+                                   for (char ch : digits.substr(pos, len))
+                                   {
+                                       chunk = chunk * 10ull + static_cast<limb_t>(ch - '0');
+                                       scale *= 10ull;
+                                   }
+                                   pos += len;
+
+                                   // res = res * scale + chunk
+                                   limb_t carry{chunk};
+                                   for (size_t i{}; i < res.m_size; i++)
+                                   {
+                                       uint128_t const cur{static_cast<uint128_t>(res.data()[i]) * scale + carry};
+                                       res.data()[i] = static_cast<limb_t>(cur);
+                                       carry = static_cast<limb_t>(cur >> 64u);
+                                   }
+                                   if (carry != 0ull)
+                                   {
+                                       res.resize(res.m_size + 1ul);
+                                       res.data()[res.m_size - 1ul] = carry;
+                                   }
+                               }
+                               return res;
+                           }};
+
+    if (str.size() <= kBaseCaseDigits)
+        *this = parseSimple(str);
+    else
     {
-        int total{num1.at(pos) + num2.at(pos) + carry};
+        // Divide and conquer: number = high * 10^(19 * 2^k) + low, where low part has 19 * 2^k digits
+        std::vector<BigInt> powers{BigInt(kChunkBase)};
+        while (kChunkDigits << powers.size() < str.size())
+            powers.emplace_back(powers.back() * powers.back());
+
+        auto const parse{[&](auto const &self, std::string_view digits, size_t level) -> BigInt
+                         {
+                             while (level != 0ul && (kChunkDigits << level) >= digits.size())
+                                 --level;
+                             if (digits.size() <= kBaseCaseDigits)
+                                 return parseSimple(digits);
+
+                             size_t const lowDigits{kChunkDigits << level};
+                             BigInt res{self(self, digits.substr(0ul, digits.size() - lowDigits), level)};
+                             res *= powers[level];
+                             return std::move(res += self(self, digits.substr(digits.size() - lowDigits), level));
+                         }};
+        *this = parse(parse, str, powers.size() - 1ul);
+    }
+
+    m_negative = negative;
+    normalize();
+}
+
+lvt::BigInt::BigInt(BigInt const &other) : m_negative(other.m_negative)
+{
+    reserve(other.m_size);
+    std::copy_n(other.data(), other.m_size, data());
+    m_size = other.m_size;
+}
+
+lvt::BigInt::BigInt(BigInt &&other) noexcept
+    : m_heap(std::move(other.m_heap)), m_size(other.m_size), m_capacity(other.m_capacity), m_negative(other.m_negative)
+{
+    if (!m_heap)
+        std::copy_n(other.m_inline, kInlineLimbs, m_inline);
+
+    // Moved-from number becomes zero
+    other.m_size = 0ul;
+    other.m_capacity = kInlineLimbs;
+    other.m_negative = false;
+}
+
+lvt::BigInt &lvt::BigInt::operator=(BigInt const &other)
+{
+    if (this != &other)
+    {
+        // Reusing existing buffer if it's big enough
+        if (m_capacity < other.m_size)
+        {
+            m_size = 0ul;
+            reserve(other.m_size);
+        }
+        std::copy_n(other.data(), other.m_size, data());
+        m_size = other.m_size;
+        m_negative = other.m_negative;
+    }
+    return *this;
+}
+
+lvt::BigInt &lvt::BigInt::operator=(BigInt &&other) noexcept
+{
+    if (this != &other)
+    {
+        m_heap = std::move(other.m_heap);
+        if (!m_heap)
+            std::copy_n(other.m_inline, kInlineLimbs, m_inline);
+        m_size = other.m_size;
+        m_capacity = other.m_capacity;
+        m_negative = other.m_negative;
+
+        other.m_size = 0ul;
+        other.m_capacity = kInlineLimbs;
+        other.m_negative = false;
+    }
+    return *this;
+}
+
+void lvt::BigInt::reserve(size_t capacity)
+{
+    if (capacity <= m_capacity)
+        return;
+
+    // Geometric growth to make repeated appending amortized O(1)
+    capacity = std::max(capacity, m_capacity + m_capacity / 2ul);
+    std::unique_ptr<limb_t[]> heap(new limb_t[capacity]);
+    std::copy_n(data(), m_size, heap.get());
+    m_heap = std::move(heap);
+    m_capacity = capacity;
+}
+
+void lvt::BigInt::resize(size_t size)
+{
+    reserve(size);
+    if (size > m_size)
+        std::fill(data() + m_size, data() + size, 0ull);
+    m_size = size;
+}
+
+void lvt::BigInt::normalize() noexcept
+{
+    while (m_size != 0ul && data()[m_size - 1ul] == 0ull)
+        --m_size;
+    if (m_size == 0ul)
+        m_negative = false;
+}
+
+int lvt::BigInt::compareMagnitude(BigInt const &a, BigInt const &b) noexcept
+{
+    if (a.m_size != b.m_size)
+        return a.m_size < b.m_size ? -1 : 1;
+    for (size_t i{a.m_size}; i-- > 0ul;)
+        if (a.data()[i] != b.data()[i])
+            return a.data()[i] < b.data()[i] ? -1 : 1;
+    return 0;
+}
+
+lvt::BigInt::limb_t lvt::BigInt::addRaw(limb_t *r, limb_t const *a, size_t na, limb_t const *b, size_t nb) noexcept
+{
+    limb_t carry{};
+    for (size_t i{}; i < nb; i++)
+    {
+        uint128_t const sum{static_cast<uint128_t>(a[i]) + b[i] + carry};
+        r[i] = static_cast<limb_t>(sum);
+        carry = static_cast<limb_t>(sum >> 64u);
+    }
+    for (size_t i{nb}; i < na; i++)
+    {
+        r[i] = a[i] + carry;
+        carry = (r[i] < carry) ? 1ull : 0ull;
+    }
+    return carry;
+}
+
+void lvt::BigInt::subRaw(limb_t *r, limb_t const *a, size_t na, limb_t const *b, size_t nb) noexcept
+{
+    limb_t borrow{};
+    for (size_t i{}; i < nb; i++)
+    {
+        uint128_t const diff{static_cast<uint128_t>(a[i]) - b[i] - borrow};
+        r[i] = static_cast<limb_t>(diff);
+        borrow = static_cast<limb_t>(diff >> 64u) & 1ull;
+    }
+    for (size_t i{nb}; i < na; i++)
+    {
+        limb_t const cur{a[i]};
+        r[i] = cur - borrow;
+        borrow = (cur < borrow) ? 1ull : 0ull;
+    }
+}
+
+// Crossover sizes of the multiplication algorithms (measured by 'BigInt::calibrateMulThresholds()' on x86-64)
+static std::atomic<size_t> g_karatsubaThreshold{32ul}, g_toom3Threshold{512ul}, g_nttThreshold{12288ul};
+
+lvt::BigInt lvt::BigInt::fromLimbs(limb_t const *limbs, size_t n)
+{
+    BigInt res;
+    res.resize(n);
+    std::copy_n(limbs, n, res.data());
+    res.normalize();
+    return res;
+}
+
+void lvt::BigInt::mulRaw(limb_t *r, limb_t const *a, size_t na, limb_t const *b, size_t nb, MulThresholds const &thresholds)
+{
+    if (na < nb)
+    {
+        std::swap(a, b);
+        std::swap(na, nb);
+    }
+    if (nb == 0ul)
+    {
+        std::fill_n(r, na, 0ull);
+        return;
+    }
+
+    bool const square{a == b && na == nb};
+    // Karatsuba needs at least 4 limbs to reduce size of the operands
+    if (nb < std::max(thresholds.karatsuba, 4ul))
+        return square ? sqrSchoolbook(r, a, na) : mulSchoolbook(r, a, na, b, nb);
+
+    // Unbalanced operands: 'a' is cut into pieces of 'nb' limbs, every piece is multiplied separately
+    if (nb <= (na + 1ul) / 2ul)
+    {
+        std::fill_n(r, na + nb, 0ull);
+        auto const piece{std::make_unique_for_overwrite<limb_t[]>(2ul * nb)};
+        for (size_t offset{}; offset < na; offset += nb)
+        {
+            size_t const len{std::min(nb, na - offset)};
+            mulRaw(piece.get(), b, nb, a + offset, len, thresholds);
+            addRaw(r + offset, r + offset, na + nb - offset, piece.get(), nb + len);
+        }
+        return;
+    }
+
+    // Pieces of the NTT are 32-bit halves of the limbs, their count in the product is limited by the transform length
+    if (nb >= thresholds.ntt && 2ul * (na + nb) <= algorithm::polynomial::kNttMaxLength)
+        return mulNTT(r, a, na, b, nb);
+    if (nb >= thresholds.toom3)
+        return mulToom3(r, a, na, b, nb, thresholds);
+    mulKaratsuba(r, a, na, b, nb, thresholds);
+}
+
+void lvt::BigInt::mulSchoolbook(limb_t *r, limb_t const *a, size_t na, limb_t const *b, size_t nb) noexcept
+{
+    // Row by row with 128-bit partial products
+    std::fill_n(r, na + nb, 0ull);
+    for (size_t i{}; i < na; i++)
+    {
+        limb_t carry{};
+        uint128_t const ai{a[i]};
+        for (size_t j{}; j < nb; j++)
+        {
+            uint128_t const cur{ai * b[j] + r[i + j] + carry};
+            r[i + j] = static_cast<limb_t>(cur);
+            carry = static_cast<limb_t>(cur >> 64u);
+        }
+        r[i + nb] = carry;
+    }
+}
+
+void lvt::BigInt::sqrSchoolbook(limb_t *r, limb_t const *a, size_t n) noexcept
+{
+    // Sum of the cross products a[i] * a[j], i < j
+    std::fill_n(r, 2ul * n, 0ull);
+    for (size_t i{}; i + 1ul < n; i++)
+    {
+        limb_t carry{};
+        uint128_t const ai{a[i]};
+        for (size_t j{i + 1ul}; j < n; j++)
+        {
+            uint128_t const cur{ai * a[j] + r[i + j] + carry};
+            r[i + j] = static_cast<limb_t>(cur);
+            carry = static_cast<limb_t>(cur >> 64u);
+        }
+        r[i + n] = carry;
+    }
+
+    // Doubling cross products and adding squares a[i]^2 on the diagonal in one pass
+    limb_t shifted{}, carry{};
+    for (size_t i{}; i < n; i++)
+    {
+        uint128_t const sq{static_cast<uint128_t>(a[i]) * a[i]};
+        limb_t const lo{r[2ul * i]}, hi{r[2ul * i + 1ul]};
+        uint128_t cur{static_cast<uint128_t>((lo << 1u) | shifted) + static_cast<limb_t>(sq) + carry};
+        r[2ul * i] = static_cast<limb_t>(cur);
+        cur = (cur >> 64u) + ((hi << 1u) | (lo >> 63u)) + static_cast<limb_t>(sq >> 64u);
+        r[2ul * i + 1ul] = static_cast<limb_t>(cur);
+        carry = static_cast<limb_t>(cur >> 64u);
+        shifted = hi >> 63u;
+    }
+}
+
+void lvt::BigInt::mulKaratsuba(limb_t *r, limb_t const *a, size_t na, limb_t const *b, size_t nb, MulThresholds const &thresholds)
+{
+    // a = a1 * B^h + a0, b = b1 * B^h + b0
+    bool const square{a == b && na == nb};
+    size_t const h{(na + 1ul) / 2ul}, na1{na - h}, nb1{nb - h};
+
+    // z0 = a0 * b0 and z2 = a1 * b1 are written directly to their places in the result
+    mulRaw(r, a, h, b, h, thresholds);
+    mulRaw(r + 2ul * h, a + h, na1, b + h, nb1, thresholds);
+
+    // z1 = (a0 + a1) * (b0 + b1) - z0 - z2
+    auto const buf{std::make_unique_for_overwrite<limb_t[]>(4ul * h + 4ul)};
+    limb_t *sa{buf.get()}, *sb{sa + h + 1ul}, *z1{sb + h + 1ul};
+    sa[h] = addRaw(sa, a, h, a + h, na1);
+    if (square)
+        sb = sa;
+    else
+        sb[h] = addRaw(sb, b, h, b + h, nb1);
+    size_t const la{(sa[h] != 0ull) ? h + 1ul : h}, lb{(sb[h] != 0ull) ? h + 1ul : h};
+    mulRaw(z1, sa, la, sb, lb, thresholds);
+    std::fill(z1 + la + lb, z1 + 2ul * h + 2ul, 0ull);
+    subRaw(z1, z1, 2ul * h + 2ul, r, 2ul * h);
+    subRaw(z1, z1, 2ul * h + 2ul, r + 2ul * h, na1 + nb1);
+
+    // z1 = a0 * b1 + a1 * b0 fits to the rest of the result, its leading limbs are zero
+    size_t len{2ul * h + 2ul};
+    while (len != 0ul && z1[len - 1ul] == 0ull)
+        --len;
+    addRaw(r + h, r + h, na + nb - h, z1, len);
+}
+
+void lvt::BigInt::mulToom3(limb_t *r, limb_t const *a, size_t na, limb_t const *b, size_t nb, MulThresholds const &thresholds)
+{
+    bool const square{a == b && na == nb};
+    size_t const k{(na + 2ul) / 3ul};
+    if (nb <= 2ul * k)
+        return mulKaratsuba(r, a, na, b, nb, thresholds);
+
+    // Values of the polynomial x2 * t^2 + x1 * t + x0 in points 0, 1, -1, -2 and infinity
+    auto const evaluate{[k](limb_t const *x, size_t n)
+                        {
+                            BigInt const x0(fromLimbs(x, k)), x1(fromLimbs(x + k, k)), x2(fromLimbs(x + 2ul * k, n - 2ul * k));
+                            BigInt const p(x0 + x2), vm1(p - x1);
+                            return std::array<BigInt, 5ul>{x0, p + x1, vm1, ((vm1 + x2) <<= 1ul) - x0, x2};
+                        }};
+    // Pointwise products use the same thresholds as the whole multiplication
+    auto const product{[&thresholds](BigInt const &x, BigInt const &y)
+                       {
+                           BigInt res;
+                           res.resize(x.m_size + y.m_size);
+                           mulRaw(res.data(), x.data(), x.m_size, y.data(), y.m_size, thresholds);
+                           res.m_negative = x.m_negative != y.m_negative;
+                           res.normalize();
+                           return res;
+                       }};
+    std::array<BigInt, 5ul> w{evaluate(a, na)};
+    if (square)
+        for (auto &el : w)
+            el = product(el, el);
+    else
+    {
+        auto const vb{evaluate(b, nb)};
+        for (size_t i{}; i < w.size(); i++)
+            w[i] = product(w[i], vb[i]);
+    }
+
+    // Bodrato's interpolation sequence, all of the divisions are exact
+    auto &[r0, r1, r2, r3, r4]{w};
+    BigInt const rm1(std::move(r2)), rm2(std::move(r3));
+    r3 = (rm2 - r1) / BigInt(3);
+    r1 = (r1 - rm1) >>= 1ul;
+    r2 = rm1 - r0;
+    r3 = ((r2 - r3) >>= 1ul) + (r4 << 1ul);
+    r2 += r1;
+    r2 -= r4;
+    r1 -= r3;
+
+    // Coefficients are non-negative and each of them fits to the rest of the result
+    std::fill_n(r, na + nb, 0ull);
+    for (size_t i{}; i < w.size(); i++)
+        addRaw(r + i * k, r + i * k, na + nb - i * k, w[i].data(), w[i].m_size);
+}
+
+void lvt::BigInt::mulNTT(limb_t *r, limb_t const *a, size_t na, limb_t const *b, size_t nb)
+{
+    using namespace algorithm::polynomial;
+    constexpr std::uint64_t p1{kNttPrimes[0]}, p2{kNttPrimes[1]}, p3{kNttPrimes[2]};
+
+    // Coefficients of the product of 32-bit pieces are less than 2^22 * 2^64 < p1 * p2 * p3 for transforms up to 2^23
+    auto const split{[](limb_t const *x, size_t n)
+                     {
+                         std::vector<std::uint32_t> pieces(2ul * n);
+                         for (size_t i{}; i < n; i++)
+                         {
+                             pieces[2ul * i] = static_cast<std::uint32_t>(x[i]);
+                             pieces[2ul * i + 1ul] = static_cast<std::uint32_t>(x[i] >> 32u);
+                         }
+                         return pieces;
+                     }};
+    bool const square{a == b && na == nb};
+    std::vector<std::uint32_t> const pa{split(a, na)}, pb{square ? std::vector<std::uint32_t>{} : split(b, nb)};
+    std::span<std::uint32_t const> const sa{pa}, sb{square ? sa : std::span<std::uint32_t const>{pb}};
+
+    size_t const resSize{sa.size() + sb.size() - 1ul}, n{std::bit_ceil(resSize)};
+    auto const r1{nttProduct<p1, 3ull, std::uint32_t>(sa, sb, n)};
+    auto const r2{nttProduct<p2, 3ull, std::uint32_t>(sa, sb, n)};
+    auto const r3{nttProduct<p3, 3ull, std::uint32_t>(sa, sb, n)};
+
+    // Carry propagation in base 2^32
+    uint128_t carry{};
+    for (size_t i{}; i < 2ul * (na + nb); i++)
+    {
+        if (i < resSize)
+            carry += crt3(r1[i], r2[i], r3[i]);
+        limb_t const piece{static_cast<std::uint32_t>(carry)};
+        carry >>= 32u;
+        if (i & 1ul)
+            r[i / 2ul] |= piece << 32u;
+        else
+            r[i / 2ul] = piece;
+    }
+}
+
+lvt::BigInt::limb_t lvt::BigInt::divSmallRaw(limb_t *q, limb_t const *a, size_t na, limb_t d) noexcept
+{
+    limb_t rem{};
+    for (size_t i{na}; i-- > 0ul;)
+    {
+        uint128_t const cur{(static_cast<uint128_t>(rem) << 64u) | a[i]};
+        q[i] = static_cast<limb_t>(cur / d);
+        rem = static_cast<limb_t>(cur % d);
+    }
+    return rem;
+}
+
+void lvt::BigInt::divModRaw(limb_t *q, limb_t *r, limb_t const *a, size_t na, limb_t const *b, size_t nb)
+{
+    // Normalizing divisor: the highest bit of the highest limb must be set
+    unsigned const shift{static_cast<unsigned>(std::countl_zero(b[nb - 1ul]))};
+    auto const shiftLeft{[shift](limb_t hi, limb_t lo)
+                         { return shift ? (hi << shift) | (lo >> (64u - shift)) : hi; }};
+
+    std::vector<limb_t> bn(nb), an(na + 1ul);
+    for (size_t i{nb}; i-- > 1ul;)
+        bn[i] = shiftLeft(b[i], b[i - 1ul]);
+    bn[0] = b[0] << shift;
+    an[na] = shift ? a[na - 1ul] >> (64u - shift) : 0ull;
+    for (size_t i{na}; i-- > 1ul;)
+        an[i] = shiftLeft(a[i], a[i - 1ul]);
+    an[0] = a[0] << shift;
+
+    uint128_t const base{static_cast<uint128_t>(1u) << 64u};
+    for (size_t j{na - nb + 1ul}; j-- > 0ul;)
+    {
+        // Estimating quotient digit by two highest limbs, it's at most 2 more than the real one
+        uint128_t const num{(static_cast<uint128_t>(an[j + nb]) << 64u) | an[j + nb - 1ul]};
+        uint128_t qhat{num / bn[nb - 1ul]}, rhat{num % bn[nb - 1ul]};
+        while (qhat >= base || qhat * bn[nb - 2ul] > ((rhat << 64u) | an[j + nb - 2ul]))
+        {
+            --qhat;
+            rhat += bn[nb - 1ul];
+            if (rhat >= base)
+                break;
+        }
+
+        // Multiplying and subtracting: an[j; j + nb] -= qhat * bn
+        limb_t carry{}, borrow{};
+        for (size_t i{}; i < nb; i++)
+        {
+            uint128_t const prod{qhat * bn[i] + carry};
+            carry = static_cast<limb_t>(prod >> 64u);
+            uint128_t const diff{static_cast<uint128_t>(an[i + j]) - static_cast<limb_t>(prod) - borrow};
+            an[i + j] = static_cast<limb_t>(diff);
+            borrow = static_cast<limb_t>(diff >> 64u) & 1ull;
+        }
+        uint128_t const diff{static_cast<uint128_t>(an[j + nb]) - carry - borrow};
+        an[j + nb] = static_cast<limb_t>(diff);
+
+        // If result is negative - quotient digit was 1 more than necessary, adding divisor back
+        if (static_cast<limb_t>(diff >> 64u) != 0ull)
+        {
+            --qhat;
+            an[j + nb] += addRaw(an.data() + j, an.data() + j, nb, bn.data(), nb);
+        }
+        q[j] = static_cast<limb_t>(qhat);
+    }
+
+    // Denormalizing remainder
+    for (size_t i{}; i < nb; i++)
+        r[i] = shift ? (an[i] >> shift) | (an[i + 1ul] << (64u - shift)) : an[i];
+}
+
+void lvt::BigInt::addSigned(BigInt const &other, bool negative)
+{
+    // a += a and a -= a are computed on the copy
+    if (this == &other)
+    {
+        BigInt const copy(other);
+        return addSigned(copy, negative);
+    }
+
+    if (m_negative == negative)
+    {
+        // Same signs: adding magnitudes
+        size_t const n{std::max(m_size, other.m_size)};
+        reserve(n + 1ul);
+        limb_t carry{};
+        if (m_size >= other.m_size)
+            carry = addRaw(data(), data(), m_size, other.data(), other.m_size);
+        else
+        {
+            size_t const oldSize{m_size};
+            resize(n);
+            carry = addRaw(data(), other.data(), n, data(), oldSize);
+        }
+        m_size = n;
+        if (carry != 0ull)
+        {
+            data()[n] = carry;
+            ++m_size;
+        }
+    }
+    else
+    {
+        // Different signs: subtracting smaller magnitude from the bigger one
+        if (compareMagnitude(*this, other) >= 0)
+            subRaw(data(), data(), m_size, other.data(), other.m_size);
+        else
+        {
+            size_t const oldSize{m_size};
+            resize(other.m_size);
+            subRaw(data(), other.data(), other.m_size, data(), oldSize);
+            m_negative = negative;
+        }
+    }
+    normalize();
+}
+
+lvt::BigInt &lvt::BigInt::operator+=(BigInt const &other)
+{
+    addSigned(other, other.m_negative);
+    return *this;
+}
+
+lvt::BigInt &lvt::BigInt::operator-=(BigInt const &other)
+{
+    addSigned(other, !other.m_negative && !other.isZero());
+    return *this;
+}
+
+lvt::BigInt &lvt::BigInt::operator*=(BigInt const &other)
+{
+    bool const negative{m_negative != other.m_negative};
+    if (isZero() || other.isZero())
+    {
+        m_size = 0ul;
+        m_negative = false;
+        return *this;
+    }
+
+    // Multiplication by a single limb is done in place
+    if (other.m_size == 1ul && this != &other)
+    {
+        limb_t carry{};
+        uint128_t const mul{other.data()[0]};
+        for (size_t i{}; i < m_size; i++)
+        {
+            uint128_t const cur{mul * data()[i] + carry};
+            data()[i] = static_cast<limb_t>(cur);
+            carry = static_cast<limb_t>(cur >> 64u);
+        }
+        if (carry != 0ull)
+        {
+            resize(m_size + 1ul);
+            data()[m_size - 1ul] = carry;
+        }
+    }
+    else
+    {
+        BigInt res;
+        res.resize(m_size + other.m_size);
+        mulRaw(res.data(), data(), m_size, other.data(), other.m_size, mulThresholds());
+        *this = std::move(res);
+    }
+
+    m_negative = negative;
+    normalize();
+    return *this;
+}
+
+std::pair<lvt::BigInt, lvt::BigInt> lvt::BigInt::divMod(BigInt const &a, BigInt const &b)
+{
+    if (b.isZero())
+        throw std::domain_error("BigInt: division by zero");
+
+    BigInt quot, rem;
+    if (compareMagnitude(a, b) < 0)
+        rem = a;
+    else if (b.m_size == 1ul)
+    {
+        quot.resize(a.m_size);
+        rem = BigInt(divSmallRaw(quot.data(), a.data(), a.m_size, b.data()[0]));
+    }
+    else
+    {
+        quot.resize(a.m_size - b.m_size + 1ul);
+        rem.resize(b.m_size);
+        divModRaw(quot.data(), rem.data(), a.data(), a.m_size, b.data(), b.m_size);
+    }
+
+    // Truncation toward zero: quotient is negative for different signs, remainder has sign of dividend
+    quot.m_negative = a.m_negative != b.m_negative;
+    rem.m_negative = a.m_negative;
+    quot.normalize();
+    rem.normalize();
+    return {std::move(quot), std::move(rem)};
+}
+
+lvt::BigInt &lvt::BigInt::operator/=(BigInt const &other)
+{
+    return *this = std::move(divMod(*this, other).first);
+}
+
+lvt::BigInt &lvt::BigInt::operator%=(BigInt const &other)
+{
+    return *this = std::move(divMod(*this, other).second);
+}
+
+lvt::BigInt &lvt::BigInt::operator<<=(size_t bits)
+{
+    if (isZero() || bits == 0ul)
+        return *this;
+
+    size_t const limbShift{bits / 64ul}, bitShift{bits % 64ul}, oldSize{m_size};
+    resize(m_size + limbShift + 1ul);
+    limb_t *const d{data()};
+    for (size_t i{oldSize + 1ul}; i-- > 0ul;)
+    {
+        limb_t const hi{(i < oldSize) ? d[i] : 0ull}, lo{(i > 0ul) ? d[i - 1ul] : 0ull};
+        d[i + limbShift] = bitShift ? (hi << bitShift) | (lo >> (64ul - bitShift)) : hi;
+    }
+    std::fill_n(d, limbShift, 0ull);
+    normalize();
+    return *this;
+}
+
+lvt::BigInt &lvt::BigInt::operator>>=(size_t bits)
+{
+    size_t const limbShift{bits / 64ul}, bitShift{bits % 64ul};
+    if (limbShift >= m_size)
+    {
+        m_size = 0ul;
+        m_negative = false;
+        return *this;
+    }
+
+    limb_t *const d{data()};
+    size_t const newSize{m_size - limbShift};
+    for (size_t i{}; i < newSize; i++)
+    {
+        limb_t const lo{d[i + limbShift]}, hi{(i + limbShift + 1ul < m_size) ? d[i + limbShift + 1ul] : 0ull};
+        d[i] = bitShift ? (lo >> bitShift) | (hi << (64ul - bitShift)) : lo;
+    }
+    m_size = newSize;
+    normalize();
+    return *this;
+}
+
+size_t lvt::BigInt::bitLength() const noexcept
+{
+    return isZero() ? 0ul : m_size * 64ul - static_cast<size_t>(std::countl_zero(data()[m_size - 1ul]));
+}
+
+lvt::BigInt lvt::BigInt::square() const
+{
+    BigInt res;
+    res.resize(2ul * m_size);
+    mulRaw(res.data(), data(), m_size, data(), m_size, mulThresholds());
+    res.normalize();
+    return res;
+}
+
+lvt::BigInt::MulThresholds lvt::BigInt::mulThresholds() noexcept
+{
+    return MulThresholds{g_karatsubaThreshold.load(std::memory_order_relaxed),
+                         g_toom3Threshold.load(std::memory_order_relaxed),
+                         g_nttThreshold.load(std::memory_order_relaxed)};
+}
+
+void lvt::BigInt::setMulThresholds(MulThresholds const &thresholds) noexcept
+{
+    g_karatsubaThreshold.store(thresholds.karatsuba, std::memory_order_relaxed);
+    g_toom3Threshold.store(thresholds.toom3, std::memory_order_relaxed);
+    g_nttThreshold.store(thresholds.ntt, std::memory_order_relaxed);
+}
+
+lvt::BigInt::MulThresholds lvt::BigInt::calibrateMulThresholds(bool apply)
+{
+    using namespace std::chrono_literals;
+    using clock = std::chrono::steady_clock;
+
+    constexpr size_t kNever{std::numeric_limits<size_t>::max()};
+    std::mt19937_64 gen(42ull);
+
+    // Best time of one call among several runs, each run lasts at least 2 ms
+    auto const measure{[](auto const &fn)
+                       {
+                           clock::duration best{clock::duration::max()};
+                           for (int run{}; run < 5; run++)
+                           {
+                               size_t iterations{};
+                               auto const start{clock::now()};
+                               clock::duration elapsed;
+                               do
+                               {
+                                   fn();
+                                   ++iterations;
+                               } while ((elapsed = clock::now() - start) < 2ms);
+                               best = std::min(best, elapsed / static_cast<clock::rep>(iterations));
+                           }
+                           return best;
+                       }};
+
+    // Smallest size (with step about 12%) from which 'fast' algorithm wins twice in a row
+    auto const crossover{[&](size_t from, size_t to, auto const &slow, auto const &fast)
+                         {
+                             size_t firstWin{to}, wins{};
+                             for (size_t n{from}; n <= to && wins < 2ul; n += std::max(n / 8ul, 1ul))
+                             {
+                                 std::vector<limb_t> a(n), b(n), r(2ul * n);
+                                 std::ranges::generate(a, std::ref(gen));
+                                 std::ranges::generate(b, std::ref(gen));
+                                 bool const win{measure([&]
+                                                        { fast(r.data(), a.data(), n, b.data(), n); }) <
+                                                measure([&]
+                                                        { slow(r.data(), a.data(), n, b.data(), n); })};
+                                 if (win && wins++ == 0ul)
+                                     firstWin = n;
+                                 else if (!win)
+                                     wins = 0ul;
+                             }
+                             return firstWin;
+                         }};
+
+    // Candidate thresholds are passed to the algorithms directly, the global ones are used by other threads.
+    // One level of Karatsuba over the schoolbook: threshold equals to the size, so halves go to the schoolbook
+    MulThresholds res{};
+    res.karatsuba = crossover(8ul, 256ul, mulSchoolbook, [](limb_t *r, limb_t const *a, size_t na, limb_t const *b, size_t nb)
+                              { mulKaratsuba(r, a, na, b, nb, {na, kNever, kNever}); });
+    res.toom3 = crossover(std::max(res.karatsuba, 64ul), 2048ul, [&](limb_t *r, limb_t const *a, size_t na, limb_t const *b, size_t nb)
+                          { mulRaw(r, a, na, b, nb, {res.karatsuba, kNever, kNever}); },
+                          [&](limb_t *r, limb_t const *a, size_t na, limb_t const *b, size_t nb)
+                          { mulToom3(r, a, na, b, nb, {res.karatsuba, na, kNever}); });
+    res.ntt = crossover(std::max(res.toom3, 256ul), 16384ul, [&](limb_t *r, limb_t const *a, size_t na, limb_t const *b, size_t nb)
+                        { mulRaw(r, a, na, b, nb, {res.karatsuba, res.toom3, kNever}); },
+                        mulNTT);
+
+    if (apply)
+        setMulThresholds(res);
+    return res;
+}
+
+lvt::BigInt lvt::BigInt::pow(BigInt base, std::uint64_t exp)
+{
+    BigInt res(1);
+    for (; exp != 0ull; exp >>= 1ull)
+    {
+        if (exp & 1ull)
+            res *= base;
+        if (exp > 1ull)
+            base *= base;
+    }
+    return res;
+}
+
+std::string lvt::BigInt::toString() const
+{
+    if (isZero())
+        return "0";
+
+    constexpr size_t kChunkDigits{19ul}, kBaseCaseLimbs{32ul};
+    constexpr limb_t kChunkBase{10'000'000'000'000'000'000ull};
+
+    // Base case: repeated division by 10^19, each remainder gives 19 digits
+    auto const convertSimple{[](BigInt const &num, std::string &out, size_t width)
+                             {
+                                 std::vector<limb_t> quot(num.data(), num.data() + num.m_size), chunks;
+                                 size_t size{quot.size()};
+                                 while (size != 0ul)
+                                 {
+                                     chunks.push_back(divSmallRaw(quot.data(), quot.data(), size, kChunkBase));
+                                     while (size != 0ul && quot[size - 1ul] == 0ull)
+                                         --size;
+                                 }
+
+                                 char buf[kChunkDigits];
+                                 size_t const digits{chunks.empty() ? 0ul : (chunks.size() - 1ul) * kChunkDigits + std::to_string(chunks.back()).size()};
+                                 if (width > digits)
+                                     out.append(width - digits, '0');
+                                 for (size_t i{chunks.size()}; i-- > 0ul;)
+                                 {
+                                     auto const [end, ec]{std::to_chars(buf, buf + kChunkDigits, chunks[i])};
+                                     size_t const len{static_cast<size_t>(end - buf)};
+                                     if (i + 1ul != chunks.size())
+                                         out.append(kChunkDigits - len, '0');
+                                     out.append(buf, len);
+                                 }
+                             }};
+
+    std::string out;
+    if (m_negative)
+        out += '-';
+
+    if (m_size <= kBaseCaseLimbs)
+    {
+        convertSimple(*this, out, 0ul);
+        return out;
+    }
+
+    // Divide and conquer: number = high * 10^(19 * 2^k) + low, where low part is printed with 19 * 2^k digits
+    std::vector<BigInt> powers{BigInt(kChunkBase)};
+    while (powers.back().m_size * 2ul <= m_size)
+        powers.emplace_back(powers.back() * powers.back());
+
+    auto const convert{[&](auto const &self, BigInt const &num, size_t level, size_t width) -> void
+                       {
+                           // Splitting number approximately in halves
+                           while (level != 0ul && powers[level].m_size > (num.m_size + 1ul) / 2ul)
+                               --level;
+                           if (num.m_size <= kBaseCaseLimbs)
+                               return convertSimple(num, out, width);
+
+                           auto const [high, low]{divMod(num, powers[level])};
+                           size_t const lowDigits{kChunkDigits << level};
+                           self(self, high, level, (width > lowDigits) ? width - lowDigits : 0ul);
+                           self(self, low, level, lowDigits);
+                       }};
+
+    BigInt absValue(*this);
+    absValue.m_negative = false;
+    convert(convert, absValue, powers.size() - 1ul, 0ul);
+    return out;
+}
+
+// Calculates sum of 2 big numbers represented as array of integer
+void big_numbers::sum(const std::vector<int> &num1, const std::vector<int> &num2, std::vector<int> &res)
+{
+    size_t pos{num1.size() - 1UL};
+    int carry{0};
+    while (pos not_eq 0)
+    {
+        int total{num1.at(pos) + num2.at(pos) + carry};
         res[pos + 1UL] = total % 10;
 
-        if (total > 9)
-            carry = 1;
-        else
-            carry = 0;
+        if (total > 9)
+            carry = 1;
+        else
+            carry = 0;
+
+        pos--;
+    }
+    res[0UL] = carry;
+}
+
+// Calculates product of 2 big numbers represented as array of integer
+void big_numbers::product(const std::vector<int> &num1, const std::vector<int> &num2, std::vector<int> &res)
+{
+    // Digits are multiplied as 'BigInt', so long numbers get sub-quadratic multiplication
+    auto const toBigInt{[](std::vector<int> const &digits)
+                        {
+                            std::string str(digits.size(), '0');
+                            std::ranges::transform(digits, str.begin(), [](int digit)
+                                                   { return static_cast<char>('0' + digit); });
+                            return str.empty() ? BigInt() : BigInt(str);
+                        }};
+    std::string const prod{(toBigInt(num1) * toBigInt(num2)).toString()};
+
+    // Result is aligned to the right, leading positions are zeroed
+    std::ranges::fill(res, 0);
+    size_t const len{std::min(prod.size(), res.size())};
+    std::transform(prod.cend() - static_cast<std::ptrdiff_t>(len), prod.cend(), res.end() - static_cast<std::ptrdiff_t>(len),
+                   [](char ch)
+                   { return ch - '0'; });
+}
+
+// Returns factorial of number
+std::string big_numbers::factorial(const int num)
+{
+    return (num > 0) ? primeSwingFactorial(static_cast<std::uint64_t>(num)).toString() : "1";
+}
+
+// Multiplies packed words by the product tree, the left subtree is multiplied by another thread
+static BigInt productOfWords(std::span<std::uint64_t const> words, unsigned threads)
+{
+    constexpr size_t kLeafWords{8ul};
+    if (words.size() <= kLeafWords)
+    {
+        BigInt res(1);
+        for (std::uint64_t word : words)
+            res *= BigInt(word);
+        return res;
+    }
+
+    auto const left{words.first(words.size() / 2ul)}, right{words.subspan(words.size() / 2ul)};
+    if (threads < 2u)
+        return productOfWords(left, 1u) * productOfWords(right, 1u);
+
+    BigInt leftProduct;
+    std::jthread worker([&]
+                        { leftProduct = productOfWords(left, threads / 2u); });
+    BigInt const rightProduct{productOfWords(right, threads - threads / 2u)};
+    worker.join();
+    leftProduct *= rightProduct;
+    return leftProduct;
+}
+
+// Appends factor to the sequence of words, consecutive factors are multiplied while product fits into word
+static void packFactor(std::vector<std::uint64_t> &words, std::uint64_t factor)
+{
+    std::uint64_t product{};
+    if (!words.empty() && !__builtin_mul_overflow(words.back(), factor, &product))
+        words.back() = product;
+    else
+        words.push_back(factor);
+}
+
+BigInt big_numbers::productTree(std::span<std::uint64_t const> factors, unsigned threads)
+{
+    if (std::ranges::find(factors, 0ull) != factors.end())
+        return BigInt();
+
+    std::vector<std::uint64_t> words;
+    for (std::uint64_t factor : factors)
+        packFactor(words, factor);
+    return productOfWords(words, std::max(threads, 1u));
+}
+
+BigInt big_numbers::productRange(std::uint64_t a, std::uint64_t b, unsigned threads)
+{
+    if (a > b)
+        return BigInt(1);
+    if (a == 0ull)
+        return BigInt();
+
+    std::vector<std::uint64_t> words;
+    for (std::uint64_t i{a};; i++)
+    {
+        packFactor(words, i);
+        if (i == b)
+            break;
+    }
+    return productOfWords(words, std::max(threads, 1u));
+}
+
+BigInt big_numbers::primeSwingFactorial(std::uint64_t n, unsigned threads)
+{
+    // Small factorials fit into 64 bits
+    if (n <= 20ull)
+    {
+        std::uint64_t res{1ull};
+        for (std::uint64_t i{2ull}; i <= n; i++)
+            res *= i;
+        return BigInt(res);
+    }
+
+    // Sieve of Eratosthenes over odd numbers: 'composite[i]' is for 2 * i + 1
+    std::vector<bool> composite(n / 2ul + 1ul);
+    std::vector<std::uint64_t> primes{2ull};
+    for (std::uint64_t i{3ull}; i <= n; i += 2ull)
+    {
+        if (composite[i / 2ull])
+            continue;
+        primes.push_back(i);
+        for (std::uint64_t j{i * i}; j <= n; j += 2ull * i)
+            composite[j / 2ull] = true;
+    }
+
+    // Factors of swing(m): prime 'p' has power equals to the count of odd numbers among m / p^k
+    auto const swing{[&primes, threads](std::uint64_t m)
+                     {
+                         std::vector<std::uint64_t> words;
+                         for (std::uint64_t p : primes)
+                         {
+                             if (p > m)
+                                 break;
+                             for (std::uint64_t q{m / p}; q != 0ull; q /= p)
+                                 if (q & 1ull)
+                                     packFactor(words, p);
+                         }
+                         return productOfWords(words, std::max(threads, 1u));
+                     }};
+
+    // n! = ((n / 2)!)^2 * swing(n), unrolled from the smallest factorial that fits into 64 bits
+    std::vector<std::uint64_t> levels;
+    for (std::uint64_t m{n}; m > 20ull; m /= 2ull)
+        levels.push_back(m);
+
+    BigInt res(primeSwingFactorial(levels.back() / 2ull, 1u));
+    for (auto it{levels.crbegin()}; it != levels.crend(); ++it)
+        res = res.square() * swing(*it);
+    return res;
+}
+
+// (a * b) mod m without overflow
+static std::uint64_t mulMod(std::uint64_t a, std::uint64_t b, std::uint64_t m)
+{
+    return static_cast<std::uint64_t>(static_cast<uint128_t>(a) * b % m);
+}
+
+static std::uint64_t powMod(std::uint64_t base, std::uint64_t exp, std::uint64_t m)
+{
+    std::uint64_t res{1ull % m};
+    for (base %= m; exp != 0ull; exp >>= 1ull)
+    {
+        if (exp & 1ull)
+            res = mulMod(res, base, m);
+        base = mulMod(base, base, m);
+    }
+    return res;
+}
+
+// Deterministic Miller-Rabin test for 64-bit numbers
+static bool isPrime64(std::uint64_t n)
+{
+    if (n < 2ull)
+        return false;
+    constexpr std::uint64_t bases[]{2ull, 3ull, 5ull, 7ull, 11ull, 13ull, 17ull, 19ull, 23ull, 29ull, 31ull, 37ull};
+    for (std::uint64_t p : bases)
+        if (n % p == 0ull)
+            return n == p;
+
+    std::uint64_t d{n - 1ull};
+    int const s{std::countr_zero(d)};
+    d >>= s;
+    for (std::uint64_t a : bases)
+    {
+        std::uint64_t x{powMod(a, d, n)};
+        if (x == 1ull || x == n - 1ull)
+            continue;
+        int i{1};
+        for (; i < s && x != n - 1ull; i++)
+            x = mulMod(x, x, n);
+        if (x != n - 1ull)
+            return false;
+    }
+    return true;
+}
+
+std::uint64_t big_numbers::factorialMod(std::uint64_t n, std::uint64_t m)
+{
+    if (m == 0ull)
+        throw std::domain_error("factorialMod(): modulus is zero");
+
+    // 'm' is among factors of n!
+    if (n >= m)
+        return 0ull;
+
+    // Wilson's theorem: n! = -1 / ((n + 1) * ... * (m - 1)) (mod m)
+    if (n >= m / 2ull && isPrime64(m))
+    {
+        std::uint64_t rest{1ull};
+        for (std::uint64_t i{n + 1ull}; i < m; i++)
+            rest = mulMod(rest, i, m);
+        return m - powMod(rest, m - 2ull, m);
+    }
+
+    std::uint64_t res{1ull % m};
+    for (std::uint64_t i{2ull}; i <= n; i++)
+        res = mulMod(res, i, m);
+    return res;
+}
+
+// Printing current time to terminal at specified format
+void lvt::time::printCurTime(const StringConvertible auto str = "%H:%M:%S")
+{
+    std::chrono::system_clock::time_point tp{std::chrono::system_clock::now()};
+    time_t tt{std::chrono::system_clock::to_time_t(tp)};
+    tm *t{localtime(&tt)};
+    std::stringstream ss;
+    ss << std::put_time(t, str);
+    std::cout << ss.str() << std::endl;
+}
+
+// Printing duration of executing some code snippet
+// At first, where do you want to start the timer, you need to write following line:
+// auto start{std::chrono::high_resolution_clock::now()};
+// and then execute this func
+void lvt::time::printExecutionTime(const auto &start)
+{
+    auto end{std::chrono::high_resolution_clock::now()};
+    auto diff{end - start};
+    std::cout << std::chrono::duration<double, std::milli>{diff}.count() << "ms" << std::endl;
+
+    /* The line above is equals to next line: */
+    // std::cout << std::chrono::duration<double, std::ratio<1, 1'000>>{diff}.count() << "ms" << std::endl;
+
+    /* If you want to print result in seconds, use this: */
+    // std::cout << std::chrono::duration<double>{diff}.count() << "s" << std::endl;
+}
+
+std::time_t lvt::time::str_to_time_t(std::string const &str, const char *format)
+{
+    struct std::tm tm;
+    std::istringstream ss(str);
+    ss >> std::get_time(&tm, format);
+    return mktime(&tm);
+}
+
+std::string lvt::time::time_t_to_str(std::time_t const &time, char const *format)
+{
+    char buf[32];
+    std::strftime(buf, 32, format, std::localtime(&time));
+    return buf;
+}
+
+std::string lvt::time::generateRandomDateOfBirth(int lowestAge, int highestAge)
+{
+    auto const today{std::chrono::floor<std::chrono::days>(std::chrono::system_clock::now())};
+    std::string res(10ul, '\0');
+    formatDate(std::span<char, 10ul>(res.data(), 10ul), randomDateOfBirth(lowestAge, highestAge, today, random::threadEngine()));
+    return res;
+}
+
+double lvt::time::CycleTimer::ticksPerNanosecond()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    // Counter is compared with the steady clock on the interval long enough to make error negligible
+    static double const ticksPerNs{[]
+                                   {
+                                       auto const clockStart{std::chrono::steady_clock::now()};
+                                       std::uint64_t const ticksStart{nowSerialized()};
+                                       while (std::chrono::steady_clock::now() - clockStart < std::chrono::milliseconds(10))
+                                           ;
+                                       std::uint64_t const ticksEnd{nowSerialized()};
+                                       auto const ns{std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                           std::chrono::steady_clock::now() - clockStart)};
+                                       return static_cast<double>(ticksEnd - ticksStart) / static_cast<double>(ns.count());
+                                   }()};
+    return ticksPerNs;
+#else
+    return 1.0;
+#endif
+}
+
+namespace
+{
+    // Ring buffer of the zones of one thread. Fields are relaxed atomics, so export can run concurrently
+    // with the writer: on x86 they are plain stores, there are no locks on the hot path
+    struct ZoneBuffer
+    {
+        struct Zone
+        {
+            std::atomic<char const *> name;
+            std::atomic<std::uint64_t> start, end;
+        };
+
+        std::unique_ptr<Zone[]> zones{std::make_unique<Zone[]>(lvt::time::kZoneBufferCapacity)};
+        std::atomic<std::uint64_t> head{}; // Count of recorded zones
+        std::atomic<std::uint64_t> tail{}; // Zones before it are cleared
+        size_t threadIndex{};
+
+        // Guarded by 'g_zoneBuffersMutex'
+        bool owned{true};          // Thread that records to the buffer is alive
+        std::uint64_t exported{}; // Zones before it were written by 'exportChromeTrace()'
+    };
+
+    // Buffers outlive their threads, so their zones can be exported later. Buffer of the exited thread
+    // is given to the new one when all of its zones are exported or cleared
+    std::mutex g_zoneBuffersMutex;
+    std::vector<std::unique_ptr<ZoneBuffer>> g_zoneBuffers;
+    size_t g_zoneThreadCount{};
+    thread_local ZoneBuffer *t_zoneBuffer{};
+
+    // Releases the buffer of the thread on exit, it's touched only when the buffer is registered
+    struct ZoneBufferOwner
+    {
+        ZoneBuffer *buffer{};
+
+        ~ZoneBufferOwner()
+        {
+            if (buffer)
+            {
+                std::lock_guard lock(g_zoneBuffersMutex);
+                buffer->owned = false;
+            }
+        }
+    };
+    thread_local ZoneBufferOwner t_zoneBufferOwner;
+
+    ZoneBuffer *registerZoneBuffer()
+    {
+        std::lock_guard lock(g_zoneBuffersMutex);
+        ZoneBuffer *buffer{};
+        for (auto const &candidate : g_zoneBuffers)
+        {
+            std::uint64_t const head{candidate->head.load(std::memory_order_relaxed)};
+            if (!candidate->owned && (candidate->tail.load(std::memory_order_relaxed) >= head || candidate->exported >= head))
+            {
+                // Zones of the previous thread aren't exported again
+                buffer = candidate.get();
+                buffer->tail.store(head, std::memory_order_relaxed);
+                break;
+            }
+        }
+        if (!buffer)
+        {
+            g_zoneBuffers.push_back(std::make_unique<ZoneBuffer>());
+            buffer = g_zoneBuffers.back().get();
+        }
+        buffer->owned = true;
+        buffer->threadIndex = ++g_zoneThreadCount;
+        t_zoneBufferOwner.buffer = buffer;
+        return buffer;
+    }
+}
+
+void lvt::time::recordZone(char const *name, std::uint64_t startTicks, std::uint64_t endTicks) noexcept
+{
+    ZoneBuffer *buffer{t_zoneBuffer};
+    if (!buffer) [[unlikely]]
+    {
+        try
+        {
+            buffer = t_zoneBuffer = registerZoneBuffer();
+        }
+        catch (...)
+        {
+            return;
+        }
+    }
+
+    std::uint64_t const head{buffer->head.load(std::memory_order_relaxed)};
+
+    // Pairs with the acquire fence of the export: if it sees any field of this zone, it sees 'head' at least
+    // as published before, so the slot is treated as torn
+    std::atomic_thread_fence(std::memory_order_release);
+    auto &zone{buffer->zones[head % kZoneBufferCapacity]};
+    zone.name.store(name, std::memory_order_relaxed);
+    zone.start.store(startTicks, std::memory_order_relaxed);
+    zone.end.store(endTicks, std::memory_order_relaxed);
+    buffer->head.store(head + 1ull, std::memory_order_release);
+}
+
+void lvt::time::exportChromeTrace(std::ostream &os)
+{
+    struct Event
+    {
+        char const *name;
+        std::uint64_t start, end;
+        size_t tid;
+    };
+
+    std::vector<Event> events;
+    {
+        std::lock_guard lock(g_zoneBuffersMutex);
+        for (auto const &buffer : g_zoneBuffers)
+        {
+            std::uint64_t const head{buffer->head.load(std::memory_order_acquire)};
+            std::uint64_t const first{std::max<std::uint64_t>(buffer->tail.load(std::memory_order_relaxed),
+                                                              head > kZoneBufferCapacity ? head - kZoneBufferCapacity : 0ull)};
+            size_t const before{events.size()};
+            for (std::uint64_t i{first}; i < head; ++i)
+            {
+                auto const &zone{buffer->zones[i % kZoneBufferCapacity]};
+                events.push_back(Event{zone.name.load(std::memory_order_relaxed), zone.start.load(std::memory_order_relaxed),
+                                       zone.end.load(std::memory_order_relaxed), buffer->threadIndex});
+            }
+
+            // Writer could wrap around while zones were copied: the oldest ones may be torn. After publishing
+            // 'newHead' it may be writing the slot of index 'newHead - kZoneBufferCapacity', so it's dropped too
+            std::atomic_thread_fence(std::memory_order_acquire);
+            std::uint64_t const newHead{buffer->head.load(std::memory_order_relaxed)};
+            buffer->exported = head;
+            if (newHead + 1ull > kZoneBufferCapacity + first)
+            {
+                size_t const torn{std::min<size_t>(newHead + 1ull - kZoneBufferCapacity - first, events.size() - before)};
+                events.erase(events.begin() + static_cast<std::ptrdiff_t>(before),
+                             events.begin() + static_cast<std::ptrdiff_t>(before + torn));
+            }
+        }
+    }
+
+    std::uint64_t const base{events.empty() ? 0ull : std::min_element(events.cbegin(), events.cend(), [](auto const &a, auto const &b)
+                                                                      { return a.start < b.start; })
+                                                         ->start};
+    double const ticksPerUs{CycleTimer::ticksPerNanosecond() * 1000.0};
+
+    std::ios_base::fmtflags const flags{os.flags()};
+    std::streamsize const precision{os.precision()};
+    os << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+    for (size_t i{}; i < events.size(); ++i)
+    {
+        auto const &e{events[i]};
+        os << (i == 0ul ? "\n" : ",\n") << "{\"name\":\"";
+        for (char const *c{e.name}; c && *c; ++c)
+        {
+            if (*c == '"' || *c == '\\')
+                os << '\\';
+            os << *c;
+        }
+        os << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << e.tid
+           << ",\"ts\":" << static_cast<double>(e.start - base) / ticksPerUs
+           << ",\"dur\":" << static_cast<double>(e.end - e.start) / ticksPerUs << '}';
+    }
+    os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    os.flags(flags);
+    os.precision(precision);
+}
+
+void lvt::time::clearZones()
+{
+    std::lock_guard lock(g_zoneBuffersMutex);
+    for (auto const &buffer : g_zoneBuffers)
+        buffer->tail.store(buffer->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+}
+
+namespace
+{
+    // Cumulative allocations of the thread, they are counted only while there are scopes ('depth' > 0)
+    struct ThreadAllocations
+    {
+        lvt::benchmark::AllocationStats total;
+        std::int64_t live, peak;
+        std::uint64_t depth;
+    };
+
+    constinit thread_local ThreadAllocations t_allocations{};
+}
+
+#ifdef LVT_TRACK_ALLOCATIONS
+static void countAllocation(void *p) noexcept
+{
+    if (!p || t_allocations.depth == 0ull) [[likely]]
+        return;
+    auto const size{static_cast<std::uint64_t>(::malloc_usable_size(p))};
+    ++t_allocations.total.allocations;
+    t_allocations.total.allocatedBytes += size;
+    t_allocations.live += static_cast<std::int64_t>(size);
+    t_allocations.peak = std::max(t_allocations.peak, t_allocations.live);
+}
+
+static void countDeallocation(void *p) noexcept
+{
+    if (!p || t_allocations.depth == 0ull) [[likely]]
+        return;
+    auto const size{static_cast<std::uint64_t>(::malloc_usable_size(p))};
+    ++t_allocations.total.deallocations;
+    t_allocations.total.freedBytes += size;
+    t_allocations.live -= static_cast<std::int64_t>(size);
+}
+
+// Allocation loop required from the replaceable 'operator new': new-handler is called until it succeeds
+static void *allocateOrThrow(size_t size, size_t alignment)
+{
+    size = std::max(size, 1ul);
+    while (true)
+    {
+        void *p{};
+        if (alignment <= alignof(std::max_align_t))
+            p = std::malloc(size);
+        else if (::posix_memalign(&p, alignment, size) != 0)
+            p = nullptr;
+        if (p)
+        {
+            countAllocation(p);
+            return p;
+        }
+        if (std::new_handler const handler{std::get_new_handler()})
+            handler();
+        else
+            throw std::bad_alloc();
+    }
+}
+
+static void deallocate(void *p) noexcept
+{
+    countDeallocation(p);
+    std::free(p);
+}
+
+void *operator new(size_t size) { return allocateOrThrow(size, alignof(std::max_align_t)); }
+void *operator new[](size_t size) { return allocateOrThrow(size, alignof(std::max_align_t)); }
+void *operator new(size_t size, std::align_val_t alignment) { return allocateOrThrow(size, static_cast<size_t>(alignment)); }
+void *operator new[](size_t size, std::align_val_t alignment) { return allocateOrThrow(size, static_cast<size_t>(alignment)); }
+
+void *operator new(size_t size, std::nothrow_t const &) noexcept
+{
+    try
+    {
+        return allocateOrThrow(size, alignof(std::max_align_t));
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+void *operator new[](size_t size, std::nothrow_t const &tag) noexcept { return operator new(size, tag); }
+
+void *operator new(size_t size, std::align_val_t alignment, std::nothrow_t const &) noexcept
+{
+    try
+    {
+        return allocateOrThrow(size, static_cast<size_t>(alignment));
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+void *operator new[](size_t size, std::align_val_t alignment, std::nothrow_t const &tag) noexcept { return operator new(size, alignment, tag); }
+
+void operator delete(void *p) noexcept { deallocate(p); }
+void operator delete[](void *p) noexcept { deallocate(p); }
+void operator delete(void *p, size_t) noexcept { deallocate(p); }
+void operator delete[](void *p, size_t) noexcept { deallocate(p); }
+void operator delete(void *p, std::align_val_t) noexcept { deallocate(p); }
+void operator delete[](void *p, std::align_val_t) noexcept { deallocate(p); }
+void operator delete(void *p, size_t, std::align_val_t) noexcept { deallocate(p); }
+void operator delete[](void *p, size_t, std::align_val_t) noexcept { deallocate(p); }
+void operator delete(void *p, std::nothrow_t const &) noexcept { deallocate(p); }
+void operator delete[](void *p, std::nothrow_t const &) noexcept { deallocate(p); }
+void operator delete(void *p, std::align_val_t, std::nothrow_t const &) noexcept { deallocate(p); }
+void operator delete[](void *p, std::align_val_t, std::nothrow_t const &) noexcept { deallocate(p); }
+#endif
+
+bool lvt::benchmark::allocationTrackingEnabled() noexcept
+{
+#ifdef LVT_TRACK_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+lvt::benchmark::AllocationScope::AllocationScope() noexcept
+    : m_start(t_allocations.total), m_startLive(t_allocations.live), m_outerPeak(t_allocations.peak)
+{
+    // Peak of this scope is counted from the current live bytes
+    t_allocations.peak = t_allocations.live;
+    ++t_allocations.depth;
+}
+
+lvt::benchmark::AllocationScope::~AllocationScope()
+{
+    --t_allocations.depth;
+    t_allocations.peak = std::max(t_allocations.peak, m_outerPeak);
+}
+
+lvt::benchmark::AllocationStats lvt::benchmark::AllocationScope::stats() const noexcept
+{
+    AllocationStats const &total{t_allocations.total};
+    AllocationStats res;
+    res.allocations = total.allocations - m_start.allocations;
+    res.deallocations = total.deallocations - m_start.deallocations;
+    res.allocatedBytes = total.allocatedBytes - m_start.allocatedBytes;
+    res.freedBytes = total.freedBytes - m_start.freedBytes;
+    res.peakBytes = static_cast<std::uint64_t>(std::max(t_allocations.peak - m_startLive, std::int64_t{}));
+    return res;
+}
+
+lvt::benchmark::PerfCounters::PerfCounters()
+{
+    m_fds.fill(-1);
+
+    struct EventConfig
+    {
+        std::uint32_t type;
+        std::uint64_t config;
+    };
+    static constexpr std::array<EventConfig, static_cast<size_t>(PerfEvent::Count)> kEvents{{
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+        {PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS},
+    }};
+
+    // The first opened event is the leader of the group, so all of them are scheduled together
+    for (size_t i{}; i < kEvents.size(); ++i)
+    {
+        perf_event_attr attr{};
+        attr.size = sizeof(attr);
+        attr.type = kEvents[i].type;
+        attr.config = kEvents[i].config;
+        attr.disabled = (m_leader == -1) ? 1 : 0;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        int const fd{static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, m_leader, PERF_FLAG_FD_CLOEXEC))};
+        if (fd == -1)
+            continue;
+        if (::ioctl(fd, PERF_EVENT_IOC_ID, &m_ids[i]) == -1)
+        {
+            ::close(fd);
+            continue;
+        }
+        m_fds[i] = fd;
+        if (m_leader == -1)
+            m_leader = fd;
+    }
+}
+
+lvt::benchmark::PerfCounters::~PerfCounters()
+{
+    for (int fd : m_fds)
+        if (fd != -1)
+            ::close(fd);
+}
+
+void lvt::benchmark::PerfCounters::start() noexcept
+{
+    if (m_leader == -1)
+        return;
+    ::ioctl(m_leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ::ioctl(m_leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+lvt::benchmark::CounterValues lvt::benchmark::PerfCounters::stop() noexcept
+{
+    CounterValues res;
+    if (m_leader == -1)
+        return res;
+    ::ioctl(m_leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    // Layout of PERF_FORMAT_GROUP: nr, time_enabled, time_running, {value, id} * nr
+    std::array<std::uint64_t, 3ul + 2ul * static_cast<size_t>(PerfEvent::Count)> buffer{};
+    if (::read(m_leader, buffer.data(), sizeof(buffer)) <= 0)
+        return res;
+
+    std::uint64_t const count{std::min<std::uint64_t>(buffer[0], static_cast<std::uint64_t>(PerfEvent::Count))};
+    std::uint64_t const enabled{buffer[1]}, running{buffer[2]};
+
+    // Group was scheduled only part of the time (counters are multiplexed): values are extrapolated
+    double const scale{(running != 0ull && running < enabled) ? static_cast<double>(enabled) / static_cast<double>(running) : 1.0};
+
+    for (std::uint64_t k{}; k < count; ++k)
+    {
+        std::uint64_t const value{buffer[3ul + 2ul * k]}, id{buffer[4ul + 2ul * k]};
+        for (size_t i{}; i < m_fds.size(); ++i)
+        {
+            if (m_fds[i] == -1 || m_ids[i] != id)
+                continue;
+            res.values[i] = static_cast<std::uint64_t>(static_cast<double>(value) * scale);
+            res.available |= 1u << i;
+            break;
+        }
+    }
+    return res;
+}
+
+lvt::benchmark::Statistics lvt::benchmark::computeStatistics(std::vector<double> samples, std::uint64_t iterationsPerSample,
+                                                             double outlierThreshold)
+{
+    Statistics stats;
+    stats.iterationsPerSample = iterationsPerSample;
+    if (samples.empty())
+        return stats;
+
+    std::sort(samples.begin(), samples.end());
+    stats.min = samples.front();
+    stats.max = samples.back();
+
+    auto const percentile{[](std::vector<double> const &sorted, double p)
+                          {
+                              double const pos{p * static_cast<double>(sorted.size() - 1ul)};
+                              size_t const lo{static_cast<size_t>(pos)};
+                              size_t const hi{std::min(lo + 1ul, sorted.size() - 1ul)};
+                              return sorted[lo] + (sorted[hi] - sorted[lo]) * (pos - static_cast<double>(lo));
+                          }};
+
+    // Median and MAD are robust, so they are calculated by all the samples
+    stats.median = percentile(samples, 0.5);
+    std::vector<double> deviations(samples.size());
+    std::transform(samples.cbegin(), samples.cend(), deviations.begin(), [median = stats.median](double x)
+                   { return std::abs(x - median); });
+    std::sort(deviations.begin(), deviations.end());
+    stats.mad = 1.4826 * percentile(deviations, 0.5);
+
+    // Outliers (i.e. samples interrupted by the scheduler) are dropped, zero MAD means that there is no spread
+    if (stats.mad > 0.0)
+        std::erase_if(samples, [&stats, outlierThreshold](double x)
+                      { return std::abs(x - stats.median) > outlierThreshold * stats.mad; });
+    stats.outliers = deviations.size() - samples.size();
+    stats.samples = samples.size();
+
+    stats.mean = std::accumulate(samples.cbegin(), samples.cend(), 0.0) / static_cast<double>(samples.size());
+    if (samples.size() > 1ul)
+    {
+        double const sq{std::accumulate(samples.cbegin(), samples.cend(), 0.0, [mean = stats.mean](double acc, double x)
+                                        { return acc + (x - mean) * (x - mean); })};
+        stats.stddev = std::sqrt(sq / static_cast<double>(samples.size() - 1ul));
+    }
+    stats.p10 = percentile(samples, 0.1);
+    stats.p90 = percentile(samples, 0.9);
+    stats.p99 = percentile(samples, 0.99);
+    return stats;
+}
+
+lvt::benchmark::Statistics lvt::benchmark::run(std::function<void(State &)> const &fn, std::int64_t arg, Options const &options)
+{
+    static constexpr std::uint64_t kMaxIterations{1ull << 40ull};
+
+    std::optional<PerfCounters> counters;
+    if (options.perfCounters)
+        counters.emplace();
+    CounterValues counted;
+    std::uint64_t countedItems{};
+    bool const trackAllocations{options.trackAllocations && allocationTrackingEnabled()};
+    AllocationStats allocated;
+
+    auto const once{[&](std::uint64_t iterations, bool count)
+                    {
+                        State state(iterations, arg, (count && counters) ? &*counters : nullptr, count && trackAllocations);
+                        fn(state);
+                        if (count)
+                        {
+                            counted += state.counted();
+                            countedItems += iterations * state.itemsPerIteration();
+                            allocated += state.allocated();
+                        }
+                        return state.elapsed();
+                    }};
+
+    // Calibration: sample must be long enough comparing to resolution of the clock and its overhead
+    std::uint64_t iterations{1ull};
+    while (iterations < kMaxIterations)
+    {
+        auto const elapsed{once(iterations, false)};
+        if (elapsed >= options.minSampleTime)
+            break;
+
+        // Prediction with the margin, but not more than 10 times at once: the first runs are the coldest
+        double const factor{elapsed.count() > 0
+                                ? 1.4 * static_cast<double>(options.minSampleTime.count()) / static_cast<double>(elapsed.count())
+                                : 10.0};
+        iterations = static_cast<std::uint64_t>(std::ceil(static_cast<double>(iterations) * std::clamp(factor, 2.0, 10.0)));
+    }
+
+    // Warm-up: caches, branch predictors, frequency of the CPU
+    for (auto const start{std::chrono::steady_clock::now()}; std::chrono::steady_clock::now() - start < options.warmupTime;)
+        once(iterations, false);
+
+    std::vector<double> samples(std::max(options.samples, 1ul));
+    for (double &sample : samples)
+        sample = static_cast<double>(once(iterations, true).count()) / static_cast<double>(iterations);
+
+    Statistics stats{computeStatistics(std::move(samples), iterations, options.outlierThreshold)};
+    if (counters && counters->available())
+    {
+        stats.counters = counted;
+        stats.countedItems = countedItems;
+    }
+    if (trackAllocations)
+    {
+        stats.allocations = allocated;
+        stats.countedIterations = iterations * std::max(options.samples, 1ul);
+    }
+    return stats;
+}
+
+namespace
+{
+    struct RegisteredBenchmark
+    {
+        std::string name;
+        std::function<void(lvt::benchmark::State &)> fn;
+        std::vector<std::int64_t> args;
+    };
+
+    // Function-local static is initialized before the first registration from any translation unit
+    std::vector<RegisteredBenchmark> &benchmarkRegistry()
+    {
+        static std::vector<RegisteredBenchmark> registry;
+        return registry;
+    }
+}
+
+bool lvt::benchmark::registerBenchmark(std::string name, std::function<void(State &)> fn, std::vector<std::int64_t> args)
+{
+    benchmarkRegistry().push_back(RegisteredBenchmark{std::move(name), std::move(fn), std::move(args)});
+    return true;
+}
+
+std::vector<std::int64_t> lvt::benchmark::range(std::int64_t lo, std::int64_t hi, std::int64_t multiplier)
+{
+    if (lo <= 0 || lo > hi || multiplier < 2)
+        throw std::invalid_argument("benchmark::range(): requires 0 < lo <= hi and multiplier >= 2");
+
+    std::vector<std::int64_t> args;
+    for (std::int64_t x{lo}; x < hi; x = (x > hi / multiplier) ? hi : x * multiplier)
+        args.push_back(x);
+    args.push_back(hi);
+    return args;
+}
+
+std::vector<lvt::benchmark::Result> lvt::benchmark::runRegistered(std::string_view filter, Options const &options)
+{
+    std::vector<Result> results;
+    for (auto const &bench : benchmarkRegistry())
+    {
+        if (!filter.empty() && bench.name.find(filter) == std::string::npos)
+            continue;
+        if (bench.args.empty())
+            results.push_back(Result{bench.name, 0, run(bench.fn, 0, options)});
+        for (std::int64_t arg : bench.args)
+            results.push_back(Result{bench.name, arg, run(bench.fn, arg, options)});
+    }
+    return results;
+}
+
+// Restores formatting of the stream changed by the writers of results
+namespace
+{
+    class StreamStateGuard
+    {
+    private:
+        std::ostream &m_os;
+        std::ios_base::fmtflags m_flags;
+        std::streamsize m_precision;
+
+    public:
+        explicit StreamStateGuard(std::ostream &os) : m_os(os), m_flags(os.flags()), m_precision(os.precision())
+        {
+            m_os << std::fixed << std::setprecision(3);
+        }
+        ~StreamStateGuard()
+        {
+            m_os.flags(m_flags);
+            m_os.precision(m_precision);
+        }
+    };
+}
+
+// Counters per item are often fractions far below 1, so they are written with significant digits
+static void writeCounterValue(std::ostream &os, double x, std::string_view missing)
+{
+    if (std::isnan(x))
+        os << missing;
+    else
+        os << std::defaultfloat << std::setprecision(6) << x << std::fixed << std::setprecision(3);
+}
+
+void lvt::benchmark::writeJson(std::ostream &os, std::span<Result const> results)
+{
+    StreamStateGuard const guard(os);
+    os << "[\n";
+    for (size_t i{}; i < results.size(); ++i)
+    {
+        auto const &[name, arg, s]{results[i]};
+        os << "  {\"name\": \"";
+        for (char c : name)
+        {
+            if (c == '"' || c == '\\')
+                os << '\\';
+            os << c;
+        }
+        os << "\", \"arg\": " << arg
+           << ", \"iterations\": " << s.iterationsPerSample << ", \"samples\": " << s.samples
+           << ", \"outliers\": " << s.outliers << ", \"min_ns\": " << s.min << ", \"max_ns\": " << s.max
+           << ", \"mean_ns\": " << s.mean << ", \"stddev_ns\": " << s.stddev << ", \"median_ns\": " << s.median
+           << ", \"mad_ns\": " << s.mad << ", \"p10_ns\": " << s.p10 << ", \"p90_ns\": " << s.p90
+           << ", \"p99_ns\": " << s.p99;
+        if (s.counters)
+        {
+            // NaN isn't valid JSON, not counted events are null
+            os << ", \"ipc\": ";
+            writeCounterValue(os, s.counters->ipc(), "null");
+            os << ", \"instructions_per_item\": ";
+            writeCounterValue(os, s.counters->per(PerfEvent::Instructions, s.countedItems), "null");
+            os << ", \"cache_misses_per_item\": ";
+            writeCounterValue(os, s.counters->per(PerfEvent::CacheMisses, s.countedItems), "null");
+            os << ", \"branch_misses_per_item\": ";
+            writeCounterValue(os, s.counters->per(PerfEvent::BranchMisses, s.countedItems), "null");
+            os << ", \"page_faults_per_item\": ";
+            writeCounterValue(os, s.counters->per(PerfEvent::PageFaults, s.countedItems), "null");
+        }
+        if (s.allocations)
+        {
+            auto const perIteration{[&s](std::uint64_t x)
+                                    { return static_cast<double>(x) / static_cast<double>(std::max(s.countedIterations, 1ul)); }};
+            os << ", \"allocations_per_iteration\": ";
+            writeCounterValue(os, perIteration(s.allocations->allocations), "null");
+            os << ", \"allocated_bytes_per_iteration\": ";
+            writeCounterValue(os, perIteration(s.allocations->allocatedBytes), "null");
+            os << ", \"peak_bytes\": " << s.allocations->peakBytes;
+        }
+        os << '}' << (i + 1ul < results.size() ? ",\n" : "\n");
+    }
+    os << "]\n";
+}
+
+void lvt::benchmark::writeCsv(std::ostream &os, std::span<Result const> results)
+{
+    StreamStateGuard const guard(os);
+    os << "name,arg,iterations,samples,outliers,min_ns,max_ns,mean_ns,stddev_ns,median_ns,mad_ns,p10_ns,p90_ns,p99_ns,"
+          "ipc,instructions_per_item,cache_misses_per_item,branch_misses_per_item,page_faults_per_item,"
+          "allocations_per_iteration,allocated_bytes_per_iteration,peak_bytes\n";
+    for (auto const &[name, arg, s] : results)
+    {
+        os << name << ',' << arg << ',' << s.iterationsPerSample << ',' << s.samples << ',' << s.outliers << ','
+           << s.min << ',' << s.max << ',' << s.mean << ',' << s.stddev << ',' << s.median << ',' << s.mad << ','
+           << s.p10 << ',' << s.p90 << ',' << s.p99;
+
+        // Not counted events are empty fields
+        CounterValues const counters{s.counters.value_or(CounterValues{})};
+        for (double x : {counters.ipc(), counters.per(PerfEvent::Instructions, s.countedItems),
+                         counters.per(PerfEvent::CacheMisses, s.countedItems),
+                         counters.per(PerfEvent::BranchMisses, s.countedItems),
+                         counters.per(PerfEvent::PageFaults, s.countedItems)})
+        {
+            os << ',';
+            writeCounterValue(os, x, "");
+        }
+
+        if (s.allocations)
+        {
+            double const iterations{static_cast<double>(std::max(s.countedIterations, 1ul))};
+            os << ',';
+            writeCounterValue(os, static_cast<double>(s.allocations->allocations) / iterations, "");
+            os << ',';
+            writeCounterValue(os, static_cast<double>(s.allocations->allocatedBytes) / iterations, "");
+            os << ',' << s.allocations->peakBytes;
+        }
+        else
+            os << ",,,";
+        os << '\n';
+    }
+}
+
+std::string_view lvt::logging::toString(Level level) noexcept
+{
+    switch (level)
+    {
+    case Level::Trace:
+        return "TRACE";
+    case Level::Debug:
+        return "DEBUG";
+    case Level::Info:
+        return "INFO";
+    case Level::Warning:
+        return "WARNING";
+    case Level::Error:
+        return "ERROR";
+    default:
+        return "OFF";
+    }
+}
+
+lvt::logging::RotatingFileSink::RotatingFileSink(std::filesystem::path path, size_t maxBytes, size_t maxFiles)
+    : m_path(std::move(path)), m_maxBytes(std::max(maxBytes, 1ul)), m_maxFiles(maxFiles) { open(); }
+
+lvt::logging::RotatingFileSink::~RotatingFileSink()
+{
+    writeBuffer();
+    if (m_fd != -1)
+        ::close(m_fd);
+}
+
+void lvt::logging::RotatingFileSink::open()
+{
+    m_fd = ::open(m_path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (m_fd == -1)
+        throw std::system_error(errno, std::generic_category(), "RotatingFileSink: can't open " + m_path.string());
+
+    struct stat st{};
+    m_size = (::fstat(m_fd, &st) == 0) ? static_cast<size_t>(st.st_size) : 0ul;
+}
+
+void lvt::logging::RotatingFileSink::writeBuffer() noexcept
+{
+    for (size_t done{}; done < m_buffer.size();)
+    {
+        ssize_t const n{::write(m_fd, m_buffer.data() + done, m_buffer.size() - done)};
+        if (n > 0)
+            done += static_cast<size_t>(n);
+        else if (n == -1 && errno == EINTR)
+            continue;
+        else
+            break; // Nowhere to report the error of the log
+    }
+    m_buffer.clear();
+}
+
+void lvt::logging::RotatingFileSink::rotate()
+{
+    writeBuffer();
+
+    auto const numbered{[this](size_t i)
+                        { return std::filesystem::path(m_path.native() + '.' + std::to_string(i)); }};
+    std::error_code ec;
+    if (m_maxFiles == 0ul)
+        std::filesystem::remove(m_path, ec);
+    else
+    {
+        std::filesystem::remove(numbered(m_maxFiles), ec);
+        for (size_t i{m_maxFiles - 1ul}; i != 0ul; --i)
+            std::filesystem::rename(numbered(i), numbered(i + 1ul), ec);
+        std::filesystem::rename(m_path, numbered(1ul), ec);
+    }
+
+    // Opened descriptor follows the renamed file: if the new file can't be opened, lines are written
+    // to the old one and the next rotation retries
+    int const oldFd{m_fd};
+    try
+    {
+        open();
+    }
+    catch (std::system_error const &)
+    {
+        m_fd = oldFd;
+        m_size = 0ul;
+        return;
+    }
+    if (oldFd != -1)
+        ::close(oldFd);
+}
+
+void lvt::logging::RotatingFileSink::write(Level, std::string_view line)
+{
+    if (m_size != 0ul && m_size + line.size() > m_maxBytes)
+        rotate();
+    m_buffer.append(line);
+    m_size += line.size();
+    if (m_buffer.size() >= (1ul << 16ul))
+        writeBuffer();
+}
+
+void lvt::logging::RotatingFileSink::flush() { writeBuffer(); }
+
+lvt::logging::RateLimiter::RateLimiter(std::uint32_t perSecond)
+    : m_perSecond(perSecond), m_windowStart(time::CycleTimer::now()), m_firstWindowStart(std::chrono::steady_clock::now()) {}
+
+bool lvt::logging::RateLimiter::firstWindowElapsed(std::uint64_t now, std::uint64_t start) noexcept
+{
+    // The first window is measured by the steady clock instead of calibration of the counter, which blocks.
+    // Its length in ticks is used for the next windows, only one thread publishes it
+    auto const elapsed{std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_firstWindowStart)};
+    if (elapsed < std::chrono::seconds(1))
+        return false;
+    std::uint64_t expected{};
+    std::uint64_t const window{std::max<std::uint64_t>(static_cast<std::uint64_t>(static_cast<double>(now - start) * 1e9 /
+                                                                                   static_cast<double>(elapsed.count())),
+                                                       1ull)};
+    if (m_windowTicks.compare_exchange_strong(expected, window, std::memory_order_relaxed))
+        return true;
+    return now - start >= expected;
+}
+
+namespace
+{
+    // Single-producer single-consumer ring of the records of variable size. Positions grow monotonically,
+    // every record is prefixed by its size (aligned by 8), record that doesn't fit before the end of the
+    // buffer is placed at the beginning and the rest of the buffer is marked as skipped
+    class LogQueue
+    {
+    private:
+        static constexpr size_t kWrapMarker{~0ul};
+
+        std::unique_ptr<std::byte[]> m_buffer;
+        size_t m_capacity; // Power of 2
+
+        alignas(64) std::atomic<size_t> m_head{}; // Written by producer
+        size_t m_pending{};                       // Head after the reserved record
+        size_t m_cachedTail{};                    // The last seen tail, so the producer rarely reads consumer's line
+
+        alignas(64) std::atomic<size_t> m_tail{}; // Written by consumer
+
+    public:
+        std::atomic<bool> closed{false}; // Thread is finished
+        std::atomic<std::uint64_t> dropped{};
+
+        explicit LogQueue(size_t capacity)
+            : m_buffer(std::make_unique_for_overwrite<std::byte[]>(capacity)), m_capacity(capacity) {}
+
+        std::byte *reserve(size_t size) noexcept
+        {
+            size_t const total{(sizeof(size_t) + size + 7ul) & ~7ul};
+            size_t const head{m_head.load(std::memory_order_relaxed)};
+            size_t const offset{head & (m_capacity - 1ul)};
+            size_t const padding{offset + total > m_capacity ? m_capacity - offset : 0ul};
+            if (padding + total > m_capacity)
+                return nullptr;
+            if (head + padding + total - m_cachedTail > m_capacity)
+            {
+                m_cachedTail = m_tail.load(std::memory_order_acquire);
+                if (head + padding + total - m_cachedTail > m_capacity)
+                    return nullptr;
+            }
+
+            if (padding != 0ul)
+                std::memcpy(&m_buffer[offset], &kWrapMarker, sizeof(size_t));
+            size_t const start{(head + padding) & (m_capacity - 1ul)};
+            std::memcpy(&m_buffer[start], &total, sizeof(size_t));
+            m_pending = head + padding + total;
+            return &m_buffer[start + sizeof(size_t)];
+        }
+
+        void commit() noexcept { m_head.store(m_pending, std::memory_order_release); }
+
+        // Calls 'fn' for every published record, returns count of them
+        template <typename Fn>
+        size_t consume(Fn &&fn)
+        {
+            size_t const head{m_head.load(std::memory_order_acquire)};
+            size_t tail{m_tail.load(std::memory_order_relaxed)};
+            size_t count{};
+            while (tail != head)
+            {
+                size_t const offset{tail & (m_capacity - 1ul)};
+                size_t size;
+                std::memcpy(&size, &m_buffer[offset], sizeof(size));
+                if (size == kWrapMarker)
+                {
+                    tail += m_capacity - offset;
+                    continue;
+                }
+                fn(&m_buffer[offset + sizeof(size_t)]);
+                tail += size;
+                ++count;
+            }
+            m_tail.store(tail, std::memory_order_release);
+            return count;
+        }
+
+        bool empty() const noexcept { return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_relaxed); }
+    };
+
+    // Marks the queue of the finished thread, backend removes it when it's empty
+    struct LogQueueHandle
+    {
+        std::shared_ptr<LogQueue> queue;
+
+        ~LogQueueHandle()
+        {
+            if (queue)
+                queue->closed.store(true, std::memory_order_release);
+        }
+    };
+
+    thread_local LogQueueHandle t_logQueue;
+}
+
+struct lvt::logging::Logger::Impl
+{
+    static constexpr auto kIdleWait{std::chrono::milliseconds(1)};
+
+    mutable std::mutex queuesMutex;
+    std::vector<std::shared_ptr<LogQueue>> queues;
+    std::uint64_t droppedByRemoved{}; // Dropped messages of the removed queues
+    std::uint64_t droppedReported{};
+
+    std::vector<std::unique_ptr<Sink>> sinks;
+    bool defaultSink{true};
+    std::mutex sinksMutex;
+
+    // Exceptions of the sinks can't leave the backend thread, they are counted and reported like dropped messages
+    std::uint64_t sinkErrors{}, sinkErrorsReported{};
+    std::string lastSinkError;
+
+    std::mutex wakeMutex;
+    std::condition_variable_any wakeCv;
+    std::uint64_t flushRequested{}, flushDone{};
+
+    // Pair of the same moment in both clocks to convert ticks of the records to the system time
+    std::chrono::system_clock::time_point baseTime{std::chrono::system_clock::now()};
+    std::uint64_t baseTicks{time::CycleTimer::now()};
+    double ticksPerNs{}; // Calibrated by the backend, so the first logging call isn't delayed
+
+    std::string line;
+    std::jthread backend; // Declared last: it's stopped before the rest is destroyed
+
+    Impl()
+    {
+        sinks.push_back(std::make_unique<StreamSink>());
+        backend = std::jthread([this](std::stop_token token)
+                               { run(token); });
+    }
+
+    std::uint64_t droppedTotal() const
+    {
+        std::uint64_t total{droppedByRemoved};
+        for (auto const &queue : queues)
+            total += queue->dropped.load(std::memory_order_relaxed);
+        return total;
+    }
+
+    template <typename Fn>
+    void callSink(Fn &&fn)
+    {
+        try
+        {
+            fn();
+        }
+        catch (std::exception const &ex)
+        {
+            ++sinkErrors;
+            lastSinkError = ex.what();
+        }
+        catch (...)
+        {
+            ++sinkErrors;
+            lastSinkError = "unknown exception";
+        }
+    }
+
+    void writeLine(Level level)
+    {
+        for (auto const &sink : sinks)
+            callSink([&]
+                     { sink->write(level, line); });
+    }
+
+    void flushSinks()
+    {
+        for (auto const &sink : sinks)
+            callSink([&]
+                     { sink->flush(); });
+    }
+
+    void formatRecord(std::byte const *record)
+    {
+        detail::RecordHeader header;
+        std::memcpy(&header, record, sizeof(header));
+
+        auto const sinceBase{static_cast<double>(static_cast<std::int64_t>(header.ticks - baseTicks)) / ticksPerNs};
+        auto const tp{baseTime + std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                                     std::chrono::duration<double, std::nano>(sinceBase))};
+
+        line.clear();
+        std::format_to(std::back_inserter(line), "{:%F %T} {}: {}({} line): {}: ",
+                       std::chrono::floor<std::chrono::microseconds>(tp), toString(header.level),
+                       header.location.file_name(), header.location.line(), header.location.function_name());
+        try
+        {
+            header.format(line, std::string_view(header.fmt, header.fmtSize), record + sizeof(header));
+        }
+        catch (std::exception const &ex)
+        {
+            line.append("<format error: ").append(ex.what()).append(">");
+        }
+        line.push_back('\n');
+        writeLine(header.level);
+    }
+
+    // Writes all published records, returns "true" if there were any
+    bool drain()
+    {
+        size_t count{};
+        std::lock_guard sinksLock(sinksMutex);
+        {
+            std::lock_guard lock(queuesMutex);
+            for (auto const &queue : queues)
+                count += queue->consume([this](std::byte const *record)
+                                        { formatRecord(record); });
+
+            // Queues of the finished threads: 'closed' is checked before 'empty' to not lose the last messages
+            std::erase_if(queues, [this](auto const &queue)
+                          {
+                              if (!queue->closed.load(std::memory_order_acquire) || !queue->empty())
+                                  return false;
+                              droppedByRemoved += queue->dropped.load(std::memory_order_relaxed);
+                              return true; });
+
+            if (std::uint64_t const dropped{droppedTotal()}; dropped != droppedReported)
+            {
+                line = std::format("{} messages were dropped: queue is full\n", dropped - droppedReported);
+                droppedReported = dropped;
+                writeLine(Level::Warning);
+                ++count;
+            }
+        }
+
+        bool const report{sinkErrors != sinkErrorsReported};
+        if (report)
+        {
+            line = std::format("{} sink errors, the last one: {}\n", sinkErrors - sinkErrorsReported, lastSinkError);
+            writeLine(Level::Error);
+        }
+        if (count != 0ul || report)
+            flushSinks();
+
+        // Failures of the report itself aren't reported again, otherwise broken sink would keep backend busy
+        if (report)
+            sinkErrorsReported = sinkErrors;
+        return count != 0ul;
+    }
+
+    void run(std::stop_token token)
+    {
+        ticksPerNs = time::CycleTimer::ticksPerNanosecond();
+        while (!token.stop_requested())
+        {
+            std::uint64_t requested;
+            {
+                std::lock_guard lock(wakeMutex);
+                requested = flushRequested;
+            }
+
+            bool const any{drain()};
+            if (requested != flushDone)
+            {
+                {
+                    std::lock_guard sinksLock(sinksMutex);
+                    flushSinks();
+                }
+                std::lock_guard lock(wakeMutex);
+                flushDone = requested;
+                wakeCv.notify_all();
+            }
+
+            if (!any)
+            {
+                std::unique_lock lock(wakeMutex);
+                wakeCv.wait_for(lock, token, kIdleWait, [this]
+                                { return flushRequested != flushDone; });
+            }
+        }
+
+        // The last messages
+        drain();
+    }
+};
+
+lvt::logging::Logger::Logger() : m_impl(std::make_unique<Impl>()) {}
+lvt::logging::Logger::~Logger() = default;
+
+lvt::logging::Logger &lvt::logging::Logger::instance()
+{
+    static Logger logger;
+    return logger;
+}
+
+std::byte *lvt::logging::Logger::reserve(size_t size) noexcept
+{
+    LogQueue *queue{t_logQueue.queue.get()};
+    if (!queue) [[unlikely]]
+    {
+        // Messages of the sinks are dropped: queues are locked by the backend while they're written
+        if (std::this_thread::get_id() == m_impl->backend.get_id())
+            return nullptr;
+        try
+        {
+            auto created{std::make_shared<LogQueue>(kQueueCapacity)};
+            {
+                std::lock_guard lock(m_impl->queuesMutex);
+                m_impl->queues.push_back(created);
+            }
+            t_logQueue.queue = std::move(created);
+            queue = t_logQueue.queue.get();
+        }
+        catch (...)
+        {
+            return nullptr;
+        }
+    }
+
+    std::byte *const p{queue->reserve(size)};
+    if (!p) [[unlikely]]
+        queue->dropped.fetch_add(1ull, std::memory_order_relaxed);
+    return p;
+}
+
+void lvt::logging::Logger::commit() noexcept { t_logQueue.queue->commit(); }
+
+void lvt::logging::Logger::addSink(std::unique_ptr<Sink> sink)
+{
+    std::lock_guard lock(m_impl->sinksMutex);
+    if (m_impl->defaultSink)
+    {
+        m_impl->sinks.clear();
+        m_impl->defaultSink = false;
+    }
+    m_impl->sinks.push_back(std::move(sink));
+}
+
+void lvt::logging::Logger::flush()
+{
+    // Sink would wait for itself
+    if (std::this_thread::get_id() == m_impl->backend.get_id())
+        return;
+
+    std::unique_lock lock(m_impl->wakeMutex);
+    std::uint64_t const ticket{++m_impl->flushRequested};
+    m_impl->wakeCv.notify_all();
+    m_impl->wakeCv.wait(lock, [this, ticket]
+                        { return m_impl->flushDone >= ticket; });
+}
+
+void lvt::logging::Logger::waitWritten() noexcept
+{
+    try
+    {
+        flush();
+    }
+    catch (std::system_error const &)
+    {
+        // Message is written later
+    }
+}
+
+std::uint64_t lvt::logging::Logger::dropped() const
+{
+    std::lock_guard lock(m_impl->queuesMutex);
+    return m_impl->droppedTotal();
+}
 
-        pos--;
+// Returns all content from a file 'filename' as a "std::string"
+std::string lvt::files::readFileToStr(std::string const &filename)
+{
+    int const fd{::open(filename.c_str(), O_RDONLY | O_CLOEXEC)};
+    if (fd == -1)
+        return {};
+
+    struct stat st{};
+    std::string content;
+    if (::fstat(fd, &st) == 0 && st.st_size > 0)
+    {
+        ::posix_fadvise(fd, 0, st.st_size, POSIX_FADV_SEQUENTIAL);
+
+        // Buffer is sized once, the read loop only continues after interrupted or partial reads
+        content.resize_and_overwrite(static_cast<size_t>(st.st_size), [fd](char *buf, size_t size)
+                                     {
+                                         size_t done{};
+                                         while (done < size)
+                                         {
+                                             ssize_t const n{::read(fd, buf + done, size - done)};
+                                             if (n > 0)
+                                                 done += static_cast<size_t>(n);
+                                             else if (n == 0 || errno != EINTR)
+                                                 break;
+                                         }
+                                         return done; });
     }
-    res[0UL] = carry;
+
+    // Files without size (e.g. in /proc) and files that grew after fstat() are read to the end by chunks
+    char chunk[65536];
+    for (ssize_t n; (n = ::read(fd, chunk, sizeof(chunk))) != 0;)
+    {
+        if (n > 0)
+            content.append(chunk, static_cast<size_t>(n));
+        else if (errno != EINTR)
+            break;
+    }
+
+    ::close(fd);
+    return content;
 }
 
-// Calculates product of 2 big numbers represented as array of integer
-void big_numbers::product(const std::vector<int> &num1, const std::vector<int> &num2, std::vector<int> &res)
+lvt::files::MappedFile::MappedFile(std::filesystem::path const &path, Advice advice, bool populate)
+{
+    int const fd{::open(path.c_str(), O_RDONLY | O_CLOEXEC)};
+    if (fd == -1)
+        throw std::system_error(errno, std::generic_category(), "MappedFile: can't open " + path.string());
+
+    struct stat st{};
+    if (::fstat(fd, &st) == -1)
+    {
+        int const err{errno};
+        ::close(fd);
+        throw std::system_error(err, std::generic_category(), "MappedFile: can't get size of " + path.string());
+    }
+
+    // Empty file can't be mapped, it's represented by the empty mapping
+    if (st.st_size > 0)
+    {
+        size_t const size{static_cast<size_t>(st.st_size)};
+        void *const data{::mmap(nullptr, size, PROT_READ, MAP_PRIVATE | (populate ? MAP_POPULATE : 0), fd, 0)};
+        if (data == MAP_FAILED)
+        {
+            int const err{errno};
+            ::close(fd);
+            throw std::system_error(err, std::generic_category(), "MappedFile: can't map " + path.string());
+        }
+        m_data = data;
+        m_size = size;
+
+#ifdef MADV_HUGEPAGE
+        // Only a hint: fails on kernels without huge pages for page cache, that's fine
+        ::madvise(m_data, m_size, MADV_HUGEPAGE);
+#endif
+        advise(advice);
+    }
+
+    // Mapping stays valid after closing of the descriptor
+    ::close(fd);
+}
+
+void lvt::files::MappedFile::close() noexcept
+{
+    if (m_data)
+        ::munmap(m_data, m_size);
+    m_data = nullptr;
+    m_size = 0ul;
+}
+
+void lvt::files::MappedFile::advise(Advice advice, size_t offset, size_t length) const noexcept
 {
-    size_t pos{res.size() - 1UL};
+    if (offset >= m_size)
+        return;
+
+    // madvise() requires address aligned to the page
+    static size_t const pageSize{static_cast<size_t>(::sysconf(_SC_PAGESIZE))};
+    size_t const begin{offset / pageSize * pageSize}, end{offset + std::min(length, m_size - offset)};
+
+    int flag{MADV_NORMAL};
+    switch (advice)
+    {
+    case Advice::Normal:
+        flag = MADV_NORMAL;
+        break;
+    case Advice::Sequential:
+        flag = MADV_SEQUENTIAL;
+        break;
+    case Advice::Random:
+        flag = MADV_RANDOM;
+        break;
+    case Advice::WillNeed:
+        flag = MADV_WILLNEED;
+        break;
+    }
+    ::madvise(static_cast<char *>(m_data) + begin, end - begin, flag);
+}
 
-    // Zeroing out all values in the 'res' array
-    for (size_t i{0UL}; i < res.size(); i++)
+struct lvt::files::ChunkReader::Impl
+{
+    int fd{-1};
+    size_t chunkSize{};
+    std::unique_ptr<char[]> buffers[2];
+    size_t sizes[2]{};
+    bool ready[2]{};     // Buffer is filled by reader and isn't released by the consumer yet
+    int errors[2]{};     // errno of the failed read into the buffer
+    size_t current{};    // Buffer that is going to be given to the consumer
+    bool holding{false}; // Consumer holds buffer 'current ^ 1'
+    off_t offset{};      // Offset of the next read when there is no read-ahead
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::jthread worker; // Declared last: it's stopped and joined before the rest is destroyed
+
+    ~Impl()
     {
-        res.at(i) = 0;
+        if (worker.joinable())
+        {
+            // Stop is requested under the lock, so it can't slip between the check of the predicate and the wait
+            {
+                std::lock_guard lock(mutex);
+                worker.request_stop();
+            }
+            cv.notify_all();
+            worker.join();
+        }
+        if (fd != -1)
+            ::close(fd);
     }
 
-    for (size_t i{num1.size() - 1UL}; i not_eq 0; i--)
+    // Reads whole chunk from 'pos' (or less at the end of the file). Returns count of bytes or -1 with 'errno'
+    ssize_t readChunk(char *buf, off_t pos) const
     {
-        size_t off{num1.size() - 1UL - i};
+        size_t done{};
+        while (done < chunkSize)
+        {
+            ssize_t const n{::pread(fd, buf + done, chunkSize - done, pos + static_cast<off_t>(done))};
+            if (n > 0)
+                done += static_cast<size_t>(n);
+            else if (n == 0)
+                break;
+            else if (errno != EINTR)
+                return -1;
+        }
+        return static_cast<ssize_t>(done);
+    }
 
-        for (size_t j{num2.size() - 1}; j not_eq 0; j--)
+    void readAhead(std::stop_token token)
+    {
+        off_t pos{};
+        for (size_t idx{};; idx ^= 1ul)
         {
-            int prod{num1.at(i) * num2.at(j)};
+            {
+                std::unique_lock lock(mutex);
+                cv.wait(lock, [&]
+                        { return !ready[idx] || token.stop_requested(); });
+                if (token.stop_requested())
+                    return;
+            }
+
+            // Buffer isn't accessed by consumer until it's marked as ready
+            ssize_t const n{readChunk(buffers[idx].get(), pos)};
+            int const err{n < 0 ? errno : 0};
+            {
+                std::lock_guard lock(mutex);
+                sizes[idx] = (n > 0) ? static_cast<size_t>(n) : 0ul;
+                errors[idx] = err;
+                ready[idx] = true;
+            }
+            cv.notify_all();
 
-            res.at(pos - off) += prod % 10;
-            res.at(pos - off - 1UL) += res.at(pos - off) / 10 + prod / 10;
-            res.at(pos - off) %= 10;
+            // End of the file or error: consumer gets empty chunk (or exception) from now on
+            if (n <= 0)
+                return;
+            pos += n;
         }
     }
+};
+
+lvt::files::ChunkReader::ChunkReader(std::filesystem::path const &path, size_t chunkSize, bool readAhead)
+    : m_impl(std::make_unique<Impl>())
+{
+    m_impl->chunkSize = std::max(chunkSize, 1ul);
+    m_impl->fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (m_impl->fd == -1)
+        throw std::system_error(errno, std::generic_category(), "ChunkReader: can't open " + path.string());
+    ::posix_fadvise(m_impl->fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+    m_impl->buffers[0] = std::make_unique_for_overwrite<char[]>(m_impl->chunkSize);
+    if (readAhead)
+    {
+        m_impl->buffers[1] = std::make_unique_for_overwrite<char[]>(m_impl->chunkSize);
+        m_impl->worker = std::jthread([impl = m_impl.get()](std::stop_token token)
+                                      { impl->readAhead(std::move(token)); });
+    }
 }
 
-// Returns factorial of number
-std::string big_numbers::factorial(const int num)
+lvt::files::ChunkReader::ChunkReader(ChunkReader &&) noexcept = default;
+lvt::files::ChunkReader &lvt::files::ChunkReader::operator=(ChunkReader &&) noexcept = default;
+lvt::files::ChunkReader::~ChunkReader() = default;
+
+std::string_view lvt::files::ChunkReader::next()
+{
+    Impl &impl{*m_impl};
+
+    // Synchronous reading into the single buffer
+    if (!impl.worker.joinable())
+    {
+        ssize_t const n{impl.readChunk(impl.buffers[0].get(), impl.offset)};
+        if (n < 0)
+            throw std::system_error(errno, std::generic_category(), "ChunkReader: read error");
+        impl.offset += n;
+        return std::string_view(impl.buffers[0].get(), static_cast<size_t>(n));
+    }
+
+    std::unique_lock lock(impl.mutex);
+    if (impl.holding)
+    {
+        // Previous chunk is released, reader may fill it
+        impl.ready[impl.current ^ 1ul] = false;
+        impl.holding = false;
+        impl.cv.notify_all();
+    }
+    impl.cv.wait(lock, [&impl]
+                 { return impl.ready[impl.current]; });
+
+    // Error of the read-ahead into the other buffer is thrown after the chunks before it are returned
+    if (int const err{impl.errors[impl.current]}; err != 0)
+        throw std::system_error(err, std::generic_category(), "ChunkReader: read error");
+
+    // Buffer with the end of the file stays ready, so every next call returns empty chunk
+    size_t const size{impl.sizes[impl.current]};
+    if (size == 0ul)
+        return {};
+
+    std::string_view const chunk(impl.buffers[impl.current].get(), size);
+    impl.holding = true;
+    impl.current ^= 1ul;
+    return chunk;
+}
+
+std::optional<std::string_view> lvt::files::LineReader::next()
 {
-    std::vector vec{1};
-    int c{0};
-    for (int i{1}; i <= num; i++)
+    m_carry.clear();
+    bool partial{false};
+    while (true)
     {
-        for (auto &d : vec)
+        if (m_chunk.empty())
+        {
+            if (m_eof || (m_chunk = m_reader.next()).empty())
+            {
+                // Last line without '\n'
+                m_eof = true;
+                if (partial)
+                    return std::string_view(m_carry);
+                return std::nullopt;
+            }
+        }
+
+        // memchr() is vectorized by the C library
+        auto const *const newline{static_cast<char const *>(std::memchr(m_chunk.data(), '\n', m_chunk.size()))};
+        if (!newline)
         {
-            int v{d * i + c};
-            d = v % 10;
-            c = v / 10;
+            m_carry.append(m_chunk);
+            m_chunk = {};
+            partial = true;
+            continue;
         }
-        for (; c > 0; c /= 10)
-            vec.push_back(c % 10);
+
+        size_t const len{static_cast<size_t>(newline - m_chunk.data())};
+        std::string_view const line{m_chunk.substr(0ul, len)};
+        m_chunk.remove_prefix(len + 1ul);
+        if (!partial)
+            return line;
+        m_carry.append(line);
+        return std::string_view(m_carry);
     }
+}
 
-    std::stringstream ss;
-    std::copy(std::rbegin(vec), std::rend(vec), std::ostream_iterator<int>(ss));
-    return ss.str();
+void lvt::files::regexFindAll(std::filesystem::path const &path, std::string const &pattern,
+                              std::function<void(std::string_view)> const &fn, int isMatch)
+{
+    std::regex const re(pattern);
+    forEachLine(path, [&](std::string_view line)
+                { std::for_each(std::cregex_token_iterator(line.data(), line.data() + line.size(), re, isMatch),
+                                std::cregex_token_iterator(), [&fn](std::csub_match const &sm)
+                                { fn(std::string_view(sm.first, sm.second)); }); });
 }
 
-// Printing current time to terminal at specified format
-void lvt::time::printCurTime(const StringConvertible auto str = "%H:%M:%S")
+std::vector<std::pair<std::string, int>> lvt::files::calculateNGramFrequencies(std::filesystem::path const &path,
+                                                                               size_t lengthOfNGramm)
 {
-    std::chrono::system_clock::time_point tp{std::chrono::system_clock::now()};
-    time_t tt{std::chrono::system_clock::to_time_t(tp)};
-    tm *t{localtime(&tt)};
-    std::stringstream ss;
-    ss << std::put_time(t, str);
-    std::cout << ss.str() << std::endl;
+    std::map<std::string, int, std::less<>> m;
+    forEachWord(path, [&m, lengthOfNGramm](std::string_view word)
+                {
+                    for (size_t j{lengthOfNGramm}; j <= word.length(); ++j)
+                    {
+                        std::string_view const ngram{word.substr(j - lengthOfNGramm, lengthOfNGramm)};
+                        if (auto const it{m.find(ngram)}; it != m.end())
+                            ++it->second;
+                        else
+                            m.emplace(ngram, 1);
+                    } });
+    return sortNGramFrequencies(m);
 }
 
-// Printing duration of executing some code snippet
-// At first, where do you want to start the timer, you need to write following line:
-// auto start{std::chrono::high_resolution_clock::now()};
-// and then execute this func
-void lvt::time::printExecutionTime(const auto &start)
+// One statx(2) call relatively to 'dirfd' (or 'AT_FDCWD'), symbolic links are followed
+static std::optional<lvt::files::FileMetadata> statxMetadata(int dirfd, char const *name)
 {
-    auto end{std::chrono::high_resolution_clock::now()};
-    auto diff{end - start};
-    std::cout << std::chrono::duration<double, std::milli>{diff}.count() << "ms" << std::endl;
+    struct statx stx{};
+    if (::statx(dirfd, name, AT_STATX_DONT_SYNC, STATX_TYPE | STATX_SIZE | STATX_MTIME, &stx) == -1)
+        return std::nullopt;
+
+    using std::filesystem::file_type;
+    lvt::files::FileMetadata m;
+    m.size = stx.stx_size;
+    switch (stx.stx_mode & S_IFMT)
+    {
+    case S_IFREG:
+        m.type = file_type::regular;
+        break;
+    case S_IFDIR:
+        m.type = file_type::directory;
+        break;
+    case S_IFLNK:
+        m.type = file_type::symlink;
+        break;
+    case S_IFBLK:
+        m.type = file_type::block;
+        break;
+    case S_IFCHR:
+        m.type = file_type::character;
+        break;
+    case S_IFIFO:
+        m.type = file_type::fifo;
+        break;
+    case S_IFSOCK:
+        m.type = file_type::socket;
+        break;
+    default:
+        m.type = file_type::unknown;
+    }
+    m.modified = std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(
+        std::chrono::seconds(stx.stx_mtime.tv_sec) + std::chrono::nanoseconds(stx.stx_mtime.tv_nsec)));
+    return m;
+}
 
-    /* The line above is equals to next line: */
-    // std::cout << std::chrono::duration<double, std::ratio<1, 1'000>>{diff}.count() << "ms" << std::endl;
+// Splits path to directory ("" for the current one) and filename without allocations.
+// Filename is the suffix of the native string, so it's null-terminated
+static std::pair<std::string_view, std::string_view> splitPath(std::filesystem::path const &path) noexcept
+{
+    std::string_view const s{path.native()};
+    size_t const slash{s.rfind('/')};
+    if (slash == std::string_view::npos)
+        return {std::string_view(), s};
+    return {s.substr(0ul, slash == 0ul ? 1ul : slash), s.substr(slash + 1ul)};
+}
 
-    /* If you want to print result in seconds, use this: */
-    // std::cout << std::chrono::duration<double>{diff}.count() << "s" << std::endl;
+std::optional<lvt::files::FileMetadata> lvt::files::metadata(std::filesystem::path const &path)
+{
+    return statxMetadata(AT_FDCWD, path.c_str());
 }
 
-std::time_t lvt::time::str_to_time_t(std::string const &str, const char *format)
+std::vector<std::optional<lvt::files::FileMetadata>> lvt::files::metadata(std::span<std::filesystem::path const> paths,
+                                                                          unsigned threads)
 {
-    struct std::tm tm;
-    std::istringstream ss(str);
-    ss >> std::get_time(&tm, format);
-    return mktime(&tm);
+    static constexpr size_t kMinPathsPerThread{1024ul};
+
+    std::vector<std::optional<FileMetadata>> result(paths.size());
+
+    // Paths of the same directory are neighbours, so the directory is opened once per thread
+    std::vector<size_t> order(paths.size());
+    std::iota(order.begin(), order.end(), 0ul);
+    std::stable_sort(order.begin(), order.end(), [paths](size_t a, size_t b)
+                     { return splitPath(paths[a]).first < splitPath(paths[b]).first; });
+
+    auto work{[paths, &order, &result](size_t begin, size_t end)
+              {
+                  std::string dir;
+                  int dirfd{AT_FDCWD};
+                  bool opened{false};
+                  for (size_t k{begin}; k < end; ++k)
+                  {
+                      auto const [d, name]{splitPath(paths[order[k]])};
+
+                      // Path like "dir/" or "/" has no filename
+                      if (name.empty())
+                      {
+                          result[order[k]] = statxMetadata(AT_FDCWD, paths[order[k]].c_str());
+                          continue;
+                      }
+
+                      if (!opened || d != dir)
+                      {
+                          if (dirfd >= 0)
+                              ::close(dirfd);
+                          dir = d;
+                          dirfd = dir.empty() ? AT_FDCWD : ::open(dir.c_str(), O_PATH | O_DIRECTORY | O_CLOEXEC);
+                          opened = true;
+                      }
+                      if (dirfd != -1)
+                          result[order[k]] = statxMetadata(dirfd, name.data());
+                  }
+                  if (dirfd >= 0)
+                      ::close(dirfd);
+              }};
+
+    size_t const count{std::clamp<size_t>(paths.size() / kMinPathsPerThread, 1ul, std::max(threads, 1u))};
+    if (count == 1ul)
+        work(0ul, paths.size());
+    else
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(count);
+        for (size_t i{}; i < count; ++i)
+            workers.emplace_back(work, paths.size() * i / count, paths.size() * (i + 1ul) / count);
+    }
+    return result;
 }
 
-std::string lvt::time::time_t_to_str(std::time_t const &time, char const *format)
+std::vector<bool> lvt::files::exists(std::span<std::filesystem::path const> paths, unsigned threads)
 {
-    char buf[32];
-    std::strftime(buf, 32, format, std::localtime(&time));
-    return buf;
+    auto const m{metadata(paths, threads)};
+    std::vector<bool> result(m.size());
+    for (size_t i{}; i < m.size(); ++i)
+        result[i] = m[i].has_value();
+    return result;
 }
 
-std::string lvt::time::generateRandomDateOfBirth(int lowestAge, int highestAge)
+std::vector<std::optional<std::uint64_t>> lvt::files::sizes(std::span<std::filesystem::path const> paths, unsigned threads)
 {
-    srand(std::time(nullptr));
-    std::chrono::system_clock::time_point tp(std::chrono::system_clock::now());
-    std::time_t tt{std::chrono::system_clock::to_time_t(tp)};
-    struct std::tm tm_;
-    int currentYear{(*std::localtime(&tt)).tm_year + 1900}, randomAge{};
-    tm_.tm_mday = rand() % 31 + 1;
-    tm_.tm_mon = rand() % 12 + 1;
-    while (randomAge < lowestAge || randomAge > highestAge)
-        randomAge = rand() % highestAge + lowestAge;
-    tm_.tm_year = currentYear - randomAge;
-    return (std::to_string(tm_.tm_mday) + '/' + std::to_string(tm_.tm_mon) +
-            '/' + std::to_string(tm_.tm_year));
+    auto const m{metadata(paths, threads)};
+    std::vector<std::optional<std::uint64_t>> result(m.size());
+    for (size_t i{}; i < m.size(); ++i)
+        if (m[i])
+            result[i] = m[i]->size;
+    return result;
 }
 
-// Returns all content from a file 'filename' as a "std::string"
-std::string lvt::files::readFileToStr(std::string const &filename)
+struct lvt::files::MetadataCache::Impl
 {
-    std::fstream fin(filename);
-    std::stringstream ss;
-    ss << fin.rdbuf();
-    return ss.str();
+    struct Entry
+    {
+        std::optional<FileMetadata> value;
+        std::chrono::steady_clock::time_point expires;
+    };
+
+    std::chrono::milliseconds ttl;
+    std::mutex mutex;
+    std::unordered_map<std::string, Entry> entries;
+
+    int inotifyFd{-1};
+    std::unordered_map<std::string, int> dirs;                    // Watched directory -> watch descriptor
+    std::unordered_map<int, std::vector<std::string>> watchDirs; // The same directory may be spelled differently
+
+    // Incremented on changes in the directory and on drops of all entries: result of the query is cached
+    // only if they weren't changed while it was made
+    std::unordered_map<std::string, std::uint64_t> generations;
+    std::uint64_t epoch{};
+
+    explicit Impl(std::chrono::milliseconds ttl_) : ttl(ttl_), inotifyFd(::inotify_init1(IN_NONBLOCK | IN_CLOEXEC)) {}
+    ~Impl()
+    {
+        if (inotifyFd != -1)
+            ::close(inotifyFd);
+    }
+
+    static std::string key(std::string_view dir, std::string_view name)
+    {
+        std::string k;
+        if (!dir.empty())
+        {
+            k = dir;
+            if (k.back() != '/')
+                k.push_back('/');
+        }
+        k.append(name);
+        return k;
+    }
+
+    void watch(std::string_view dir)
+    {
+        if (inotifyFd == -1 || dirs.contains(std::string(dir)))
+            return;
+
+        std::string const d(dir);
+        int const wd{::inotify_add_watch(inotifyFd, d.empty() ? "." : d.c_str(),
+                                         IN_ONLYDIR | IN_ATTRIB | IN_MODIFY | IN_CLOSE_WRITE | IN_CREATE | IN_DELETE |
+                                             IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF)};
+        // Missing directory or watch limit: entries live until TTL expires
+        if (wd == -1)
+            return;
+        dirs.emplace(d, wd);
+        watchDirs[wd].push_back(d);
+    }
+
+    std::uint64_t generation(std::string const &dir) const
+    {
+        auto const it{generations.find(dir)};
+        return it == generations.end() ? 0ull : it->second;
+    }
+
+    void dropDirectory(std::string const &dir)
+    {
+        ++generations[dir];
+        std::string const prefix{key(dir, "")};
+        std::erase_if(entries, [&prefix](auto const &entry)
+                      { return entry.first.starts_with(prefix); });
+    }
+
+    // Applies pending inotify events, must be called under the lock
+    void drainEvents()
+    {
+        if (inotifyFd == -1)
+            return;
+
+        alignas(struct inotify_event) char buffer[16384];
+        while (true)
+        {
+            ssize_t const n{::read(inotifyFd, buffer, sizeof(buffer))};
+            if (n <= 0)
+                break;
+
+            for (ssize_t offset{}; offset < n;)
+            {
+                auto const *const event{reinterpret_cast<struct inotify_event const *>(buffer + offset)};
+                offset += static_cast<ssize_t>(sizeof(struct inotify_event) + event->len);
+
+                // Lost events: nothing in the cache can be trusted
+                if (event->mask & IN_Q_OVERFLOW)
+                {
+                    entries.clear();
+                    ++epoch;
+                    continue;
+                }
+
+                auto const it{watchDirs.find(event->wd)};
+                if (it == watchDirs.end())
+                    continue;
+
+                if (event->mask & (IN_DELETE_SELF | IN_MOVE_SELF | IN_IGNORED))
+                {
+                    // Watch follows the moved directory: it's removed, so directory created at the path is watched again
+                    if (event->mask & IN_MOVE_SELF)
+                        ::inotify_rm_watch(inotifyFd, event->wd);
+                    bool const unwatched{(event->mask & (IN_MOVE_SELF | IN_IGNORED)) != 0u};
+                    for (auto const &dir : it->second)
+                    {
+                        dropDirectory(dir);
+                        if (unwatched)
+                            dirs.erase(dir);
+                    }
+                    if (unwatched)
+                        watchDirs.erase(it);
+                    continue;
+                }
+
+                if (event->len != 0u)
+                    for (auto const &dir : it->second)
+                    {
+                        ++generations[dir];
+                        entries.erase(key(dir, event->name));
+                    }
+            }
+        }
+    }
+};
+
+lvt::files::MetadataCache::MetadataCache(std::chrono::milliseconds ttl) : m_impl(std::make_unique<Impl>(ttl)) {}
+lvt::files::MetadataCache::MetadataCache(MetadataCache &&) noexcept = default;
+lvt::files::MetadataCache &lvt::files::MetadataCache::operator=(MetadataCache &&) noexcept = default;
+lvt::files::MetadataCache::~MetadataCache() = default;
+
+std::optional<lvt::files::FileMetadata> lvt::files::MetadataCache::get(std::filesystem::path const &path)
+{
+    auto const [dir, name]{splitPath(path)};
+    std::string const k{Impl::key(dir, name)};
+    std::uint64_t epoch, generation;
+    {
+        std::lock_guard lock(m_impl->mutex);
+        m_impl->drainEvents();
+        if (auto const it{m_impl->entries.find(k)};
+            it != m_impl->entries.end() && it->second.expires > std::chrono::steady_clock::now())
+            return it->second.value;
+
+        // Watch is added before the query, so events of the changes made during the query are received
+        m_impl->watch(dir);
+        epoch = m_impl->epoch;
+        generation = m_impl->generation(std::string(dir));
+    }
+
+    // Query isn't made under the lock to not serialize concurrent callers. Its result may be already stale
+    // when directory was changed meanwhile (event could be drained by another caller), then it isn't cached
+    auto value{metadata(path)};
+    std::lock_guard lock(m_impl->mutex);
+    m_impl->drainEvents();
+    if (m_impl->epoch == epoch && m_impl->generation(std::string(dir)) == generation)
+        m_impl->entries.insert_or_assign(k, Impl::Entry{value, std::chrono::steady_clock::now() + m_impl->ttl});
+    return value;
 }
 
-// Returns size of the file as a "std::size_t"
-size_t lvt::files::getSizeOfTheFile(std::string const &filename)
+void lvt::files::MetadataCache::invalidate(std::filesystem::path const &path)
 {
-    return std::filesystem::file_size(filename);
+    auto const [dir, name]{splitPath(path)};
+    std::lock_guard lock(m_impl->mutex);
+    ++m_impl->generations[std::string(dir)];
+    m_impl->entries.erase(Impl::key(dir, name));
 }
 
-bool lvt::files::exists(std::string const &filename)
+void lvt::files::MetadataCache::clear()
 {
-    std::ifstream ifs(filename.c_str());
-    return ifs.good();
+    std::lock_guard lock(m_impl->mutex);
+    m_impl->entries.clear();
+    ++m_impl->epoch;
+    for (auto const &[wd, dirs] : m_impl->watchDirs)
+        ::inotify_rm_watch(m_impl->inotifyFd, wd);
+    m_impl->drainEvents();
+    m_impl->dirs.clear();
+    m_impl->watchDirs.clear();
 }
 
+// Returns size of the file as a "std::size_t"
+size_t lvt::files::getSizeOfTheFile(std::string const &filename)
+{
+    auto const m{statxMetadata(AT_FDCWD, filename.c_str())};
+    if (!m)
+        throw std::filesystem::filesystem_error("getSizeOfTheFile", filename, std::error_code(errno, std::generic_category()));
+    if (m->type == std::filesystem::file_type::directory)
+        throw std::filesystem::filesystem_error("getSizeOfTheFile", filename,
+                                                std::make_error_code(std::errc::is_a_directory));
+    return m->size;
+}
+
+bool lvt::files::exists(std::string const &filename) { return statxMetadata(AT_FDCWD, filename.c_str()).has_value(); }
+
 std::vector<std::string> lvt::files::getFilenamesByMask(std::filesystem::path const &path,
                                                         std::string const &mask)
 {
     std::vector<std::string> files;
-    std::regex pattern(mask);
-
-    for (auto const &file : std::filesystem::directory_iterator(path))
-        if (std::filesystem::is_regular_file(file))
-        {
-            std::string filename{file.path().filename().string()};
-
-            // If 'filename' matches with the pattern - add it to vector of files
-            if (std::regex_match(filename, pattern))
-                files.emplace_back(filename);
-        }
+    std::regex const pattern(mask);
 
+    // If 'filename' matches with the pattern - add it to vector of files
+    walkDirectory(path, [&](std::string_view, std::string_view filename)
+                  {
+                      if (std::regex_match(filename.cbegin(), filename.cend(), pattern))
+                          files.emplace_back(filename); }, WalkOptions{.maxDepth = 0, .threads = 1u});
     return files;
 }
 
@@ -808,17 +4320,352 @@ std::vector<std::string> lvt::files::getFilenamesByMaskInDirsAndSubdirs(std::fil
                                                                         std::string const &mask)
 {
     std::vector<std::string> files;
-    std::regex pattern(mask);
+    std::mutex mutex;
+    std::regex const pattern(mask);
+
+    walkDirectory(path, [&](std::string_view, std::string_view filename)
+                  {
+                      if (std::regex_match(filename.cbegin(), filename.cend(), pattern))
+                      {
+                          std::lock_guard lock(mutex);
+                          files.emplace_back(filename);
+                      } });
+    return files;
+}
+
+lvt::files::GlobPattern::GlobPattern(std::string_view pattern)
+{
+    for (size_t i{}; i < pattern.size(); ++i)
+    {
+        char const c{pattern[i]};
+        if (c == '*')
+        {
+            // Consecutive stars are the same as the single one
+            if (m_tokens.empty() || m_tokens.back().kind != Kind::Star)
+                m_tokens.push_back({Kind::Star, '\0', 0});
+        }
+        else if (c == '?')
+            m_tokens.push_back({Kind::Any, '\0', 0});
+        else if (c == '\\')
+        {
+            if (++i == pattern.size())
+                throw std::invalid_argument(std::format("GlobPattern: trailing '\\' in \"{}\"", pattern));
+            m_tokens.push_back({Kind::Char, pattern[i], 0});
+        }
+        else if (c == '[')
+        {
+            std::array<bool, 256ul> set{};
+            size_t j{i + 1ul};
+            bool const negate{j < pattern.size() && (pattern[j] == '!' || pattern[j] == '^')};
+            if (negate)
+                ++j;
+
+            // ']' right after the '[' (or negation) is the character of the set
+            size_t const first{j};
+            for (; j < pattern.size() && (pattern[j] != ']' || j == first); ++j)
+            {
+                auto lo{static_cast<unsigned char>(pattern[j])}, hi{lo};
+                if (j + 2ul < pattern.size() && pattern[j + 1ul] == '-' && pattern[j + 2ul] != ']')
+                {
+                    hi = static_cast<unsigned char>(pattern[j + 2ul]);
+                    j += 2ul;
+                }
+                for (unsigned ch{lo}; ch <= hi; ++ch)
+                    set[ch] = true;
+            }
+            if (j == pattern.size())
+                throw std::invalid_argument(std::format("GlobPattern: unclosed '[' in \"{}\"", pattern));
+
+            if (negate)
+                for (bool &b : set)
+                    b = !b;
+            m_tokens.push_back({Kind::Set, '\0', static_cast<std::uint16_t>(m_sets.size())});
+            m_sets.push_back(set);
+            i = j;
+        }
+        else
+            m_tokens.push_back({Kind::Char, c, 0});
+    }
+
+    // The most common pattern "*.ext" doesn't need the general matching
+    if (!m_tokens.empty() && m_tokens.front().kind == Kind::Star &&
+        std::all_of(std::next(m_tokens.cbegin()), m_tokens.cend(), [](Token const &t)
+                    { return t.kind == Kind::Char; }))
+    {
+        m_suffixOnly = true;
+        for (auto it{std::next(m_tokens.cbegin())}; it != m_tokens.cend(); ++it)
+            m_suffix.push_back(it->ch);
+    }
+}
+
+bool lvt::files::GlobPattern::match(std::string_view str) const noexcept
+{
+    if (m_suffixOnly)
+        return str.ends_with(m_suffix);
+
+    auto matchOne{[this](Token const &t, char c)
+                  { return t.kind == Kind::Any ||
+                           (t.kind == Kind::Char && t.ch == c) ||
+                           (t.kind == Kind::Set && m_sets[t.set][static_cast<unsigned char>(c)]); }};
+
+    // Backtracking only to the last star: O(pattern * string) in the worst case
+    size_t t{}, i{}, starToken{std::string_view::npos}, starPos{};
+    while (i < str.size())
+    {
+        if (t < m_tokens.size() && m_tokens[t].kind == Kind::Star)
+        {
+            starToken = t++;
+            starPos = i;
+        }
+        else if (t < m_tokens.size() && matchOne(m_tokens[t], str[i]))
+        {
+            ++t;
+            ++i;
+        }
+        else if (starToken != std::string_view::npos)
+        {
+            t = starToken + 1ul;
+            i = ++starPos;
+        }
+        else
+            return false;
+    }
+    while (t < m_tokens.size() && m_tokens[t].kind == Kind::Star)
+        ++t;
+    return t == m_tokens.size();
+}
+
+namespace
+{
+    // State shared by the threads of 'files::walkDirectory()'
+    class DirectoryWalker
+    {
+    private:
+        struct Directory
+        {
+            std::string path;
+            int depth{};
+        };
+
+        struct Queue
+        {
+            std::mutex mutex;
+            std::deque<Directory> dirs;
+        };
+
+        static constexpr size_t kBufferWords{8192ul}; // 64 KiB for getdents64(2)
+
+        std::function<void(std::string_view, std::string_view)> const &m_fn;
+        lvt::files::WalkOptions const &m_options;
+        std::unique_ptr<Queue[]> m_queues;
+        size_t m_queueCount{};
+        std::atomic<size_t> m_pending{}; // Directories that are queued or being read
+        std::atomic<bool> m_stop{false};
+
+        std::mutex m_errorMutex;
+        std::exception_ptr m_error;
+
+        std::mutex m_visitedMutex;
+        std::set<std::pair<dev_t, ino_t>> m_visited; // Only for 'SymlinkPolicy::Follow'
+
+        void push(size_t self, Directory dir)
+        {
+            m_pending.fetch_add(1ul, std::memory_order_relaxed);
+            std::lock_guard lock(m_queues[self].mutex);
+            m_queues[self].dirs.push_back(std::move(dir));
+        }
 
-    for (auto const &file : std::filesystem::recursive_directory_iterator(path))
-        if (std::filesystem::is_regular_file(file))
+        // Takes the newest directory from the own queue (depth first, hot in cache) or steals the oldest one
+        // from another queue (the biggest subtree is probably near the root)
+        bool pop(size_t self, Directory &dir)
         {
-            std::string filename{file.path().filename().string()};
+            for (size_t k{}; k < m_queueCount; ++k)
+            {
+                Queue &queue{m_queues[(self + k) % m_queueCount]};
+                std::lock_guard lock(queue.mutex);
+                if (queue.dirs.empty())
+                    continue;
+                if (k == 0ul)
+                {
+                    dir = std::move(queue.dirs.back());
+                    queue.dirs.pop_back();
+                }
+                else
+                {
+                    dir = std::move(queue.dirs.front());
+                    queue.dirs.pop_front();
+                }
+                return true;
+            }
+            return false;
+        }
+
+        bool firstVisit(int fd)
+        {
+            struct stat st{};
+            if (::fstat(fd, &st) == -1)
+                return false;
+            std::lock_guard lock(m_visitedMutex);
+            return m_visited.emplace(st.st_dev, st.st_ino).second;
+        }
+
+        void readDirectory(size_t self, Directory const &dir, std::uint64_t *buffer, std::string &path)
+        {
+            int const fd{::open(dir.path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC)};
+            if (fd == -1)
+            {
+                if (dir.depth == 0)
+                    throw std::system_error(errno, std::generic_category(), "walkDirectory: can't open " + dir.path);
+                return;
+            }
+
+            // Closes directory even if 'm_fn' throws
+            std::unique_ptr<int const, decltype([](int const *p)
+                                                { ::close(*p); })> const guard(&fd);
+            if (m_options.symlinks == lvt::files::SymlinkPolicy::Follow && !firstVisit(fd))
+                return;
+
+            bool const descend{m_options.maxDepth < 0 || dir.depth < m_options.maxDepth};
+            path = dir.path;
+            if (path.back() != '/')
+                path.push_back('/');
+            size_t const base{path.size()};
+
+            while (true)
+            {
+                ssize_t const n{::getdents64(fd, buffer, kBufferWords * sizeof(std::uint64_t))};
+                if (n <= 0)
+                {
+                    if (n == -1 && errno == EINTR)
+                        continue;
+                    break;
+                }
+
+                for (ssize_t offset{}; offset < n;)
+                {
+                    auto const *const entry{reinterpret_cast<struct dirent64 const *>(
+                        reinterpret_cast<char const *>(buffer) + offset)};
+                    offset += entry->d_reclen;
+
+                    char const *const name{entry->d_name};
+                    if (name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0')))
+                        continue;
+
+                    unsigned char type{entry->d_type};
+                    if (type == DT_UNKNOWN || type == DT_LNK)
+                    {
+                        bool link{type == DT_LNK};
+                        if (link && m_options.symlinks == lvt::files::SymlinkPolicy::Skip)
+                            continue;
+
+                        // File system without 'd_type' or target of the link
+                        struct stat st{};
+                        if (::fstatat(fd, name, &st, link ? 0 : AT_SYMLINK_NOFOLLOW) == -1)
+                            continue;
+
+                        // Link found without 'd_type': its target is resolved as for 'DT_LNK'
+                        if (!link && S_ISLNK(st.st_mode))
+                        {
+                            if (m_options.symlinks == lvt::files::SymlinkPolicy::Skip)
+                                continue;
+                            link = true;
+                            if (::fstatat(fd, name, &st, 0) == -1)
+                                continue;
+                        }
+                        type = S_ISREG(st.st_mode) ? DT_REG : (S_ISDIR(st.st_mode) ? DT_DIR : DT_UNKNOWN);
+                        if (type == DT_DIR && link && m_options.symlinks != lvt::files::SymlinkPolicy::Follow)
+                            continue;
+                    }
+
+                    if (type == DT_REG)
+                    {
+                        path.resize(base);
+                        path.append(name);
+                        m_fn(path, std::string_view(path).substr(base));
+                    }
+                    else if (type == DT_DIR && descend)
+                    {
+                        path.resize(base);
+                        path.append(name);
+                        push(self, Directory{path, dir.depth + 1});
+                    }
+                }
+            }
+        }
+
+        void work(size_t self)
+        {
+            auto const buffer{std::make_unique_for_overwrite<std::uint64_t[]>(kBufferWords)};
+            std::string path;
+            Directory dir;
+            while (!m_stop.load(std::memory_order_relaxed))
+            {
+                if (pop(self, dir))
+                {
+                    try
+                    {
+                        readDirectory(self, dir, buffer.get(), path);
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard lock(m_errorMutex);
+                        if (!m_error)
+                            m_error = std::current_exception();
+                        m_stop.store(true, std::memory_order_relaxed);
+                    }
+                    // Subdirectories are already counted, so zero means the whole tree is read
+                    m_pending.fetch_sub(1ul, std::memory_order_acq_rel);
+                }
+                else if (m_pending.load(std::memory_order_acquire) == 0ul)
+                    break;
+                else
+                    std::this_thread::yield();
+            }
+        }
 
-            // If 'filename' matches with the pattern - add it to vector of files
-            if (std::regex_match(filename, pattern))
-                files.emplace_back(filename);
+    public:
+        DirectoryWalker(std::function<void(std::string_view, std::string_view)> const &fn,
+                        lvt::files::WalkOptions const &options)
+            : m_fn(fn), m_options(options),
+              m_queueCount(std::max(options.threads, 1u)) { m_queues = std::make_unique<Queue[]>(m_queueCount); }
+
+        void run(std::string root)
+        {
+            if (root.empty())
+                root = ".";
+            push(0ul, Directory{std::move(root), 0});
+            {
+                std::vector<std::jthread> workers;
+                for (size_t i{1ul}; i < m_queueCount; ++i)
+                    workers.emplace_back([this, i]
+                                         { work(i); });
+                work(0ul);
+            }
+            if (m_error)
+                std::rethrow_exception(m_error);
         }
+    };
+}
+
+void lvt::files::walkDirectory(std::filesystem::path const &root,
+                               std::function<void(std::string_view, std::string_view)> const &fn,
+                               WalkOptions const &options)
+{
+    DirectoryWalker(fn, options).run(root.string());
+}
 
+std::vector<std::string> lvt::files::findFiles(std::filesystem::path const &root, GlobPattern const &glob,
+                                               WalkOptions const &options)
+{
+    std::vector<std::string> files;
+    std::mutex mutex;
+    walkDirectory(root, [&](std::string_view path, std::string_view filename)
+                  {
+                      if (glob.match(filename))
+                      {
+                          std::lock_guard lock(mutex);
+                          files.emplace_back(path);
+                      } }, options);
+    std::sort(files.begin(), files.end());
     return files;
 }
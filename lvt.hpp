@@ -24,19 +24,79 @@
 #include <source_location>
 #include <format>
 #include <cassert>
+#include <bit>
+#include <complex>
+#include <numbers>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <memory>
+#include <compare>
+#include <array>
+#include <optional>
+#include <memory_resource>
+#include <cstring>
+#include <cstdio>
+#include <charconv>
+#include <variant>
+#include <expected>
+#include <mutex>
+#include <exception>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
 
 #include "lvt_impl.hpp"
 
-#define ERRMSG(desc) std::cerr << std::format("ERROR: {}: {}({} line): {}: {}\n",          \
-                                              std::chrono::system_clock::now(),            \
-                                              std::source_location::current().file_name(), \
-                                              std::source_location::current().line(),      \
-                                              __PRETTY_FUNCTION__, desc);
-#define LOGMSG(desc) std::clog << std::format("LOG: {}: {}({} line): {}: {}\n",            \
-                                              std::chrono::system_clock::now(),            \
-                                              std::source_location::current().file_name(), \
-                                              std::source_location::current().line(),      \
-                                              __PRETTY_FUNCTION__, desc);
+// Messages with lower level are removed at compile time: 0 - trace, 1 - debug, 2 - info, 3 - warning, 4 - error, 5 - off
+#ifndef LVT_LOG_ACTIVE_LEVEL
+#define LVT_LOG_ACTIVE_LEVEL 0
+#endif
+
+#define LVT_LOG(level, ...)                                                                                         \
+    do                                                                                                              \
+    {                                                                                                               \
+        if constexpr (::lvt::logging::isCompiledIn(level))                                                          \
+            ::lvt::logging::Logger::instance().log(level, std::source_location::current(), __VA_ARGS__);            \
+    } while (false)
+
+// Writes at most 'perSecond' messages per second from this place of the code
+#define LVT_LOG_RATE_LIMITED(level, perSecond, ...)                                                                 \
+    do                                                                                                              \
+    {                                                                                                               \
+        if constexpr (::lvt::logging::isCompiledIn(level))                                                          \
+        {                                                                                                           \
+            static ::lvt::logging::RateLimiter lvtRateLimiter(perSecond);                                           \
+            if (lvtRateLimiter.allow())                                                                             \
+                ::lvt::logging::Logger::instance().log(level, std::source_location::current(), __VA_ARGS__);        \
+        }                                                                                                           \
+    } while (false)
+
+#define LVT_LOG_TRACE(...) LVT_LOG(::lvt::logging::Level::Trace, __VA_ARGS__)
+#define LVT_LOG_DEBUG(...) LVT_LOG(::lvt::logging::Level::Debug, __VA_ARGS__)
+#define LVT_LOG_INFO(...) LVT_LOG(::lvt::logging::Level::Info, __VA_ARGS__)
+#define LVT_LOG_WARNING(...) LVT_LOG(::lvt::logging::Level::Warning, __VA_ARGS__)
+#define LVT_LOG_ERROR(...) LVT_LOG(::lvt::logging::Level::Error, __VA_ARGS__)
+
+// Messages are written by the asynchronous logger (see 'lvt::logging::Logger'), errors are waited for.
+// Logger is a function-local static: objects with static storage that are constructed before its first use
+// are destroyed after it, so their destructors mustn't log
+#define ERRMSG(desc) LVT_LOG_ERROR("{}", desc)
+#define LOGMSG(desc) LVT_LOG_INFO("{}", desc)
+
+#define LVT_CONCAT_IMPL(a, b) a##b
+#define LVT_CONCAT(a, b) LVT_CONCAT_IMPL(a, b)
+
+// Registers 'void fn(lvt::benchmark::State &)' to be run by 'lvt::benchmark::runRegistered()'
+// for every passed argument, i.e. LVT_BENCHMARK(sortBench, 1000, 100000) or
+// LVT_BENCHMARK(sortBench, lvt::benchmark::range(8, 1 << 20))
+#define LVT_BENCHMARK(fn, ...)                                                                 \
+    [[maybe_unused]] static bool const LVT_CONCAT(lvtBenchmarkRegistered_, __LINE__)           \
+    {                                                                                          \
+        ::lvt::benchmark::registerBenchmark(#fn, fn, std::vector<std::int64_t>{__VA_ARGS__})   \
+    }
 
 using namespace std::chrono_literals;
 
@@ -215,54 +275,549 @@ namespace lvt
     template <typename R, typename T>
     concept Matrix = std::convertible_to<std::ranges::range_reference_t<std::ranges::range_reference_t<R>>, T>;
 
+    /// @brief 128-bit integer types (GCC/Clang extension) for wide intermediate results
+    __extension__ using int128_t = __int128;
+    __extension__ using uint128_t = unsigned __int128;
+
+    /**
+     * @brief Non-owning view of a row-major 2D-array with an arbitrary row stride (like "std::mdspan"
+     * with "std::layout_stride" for rows). Can point into a part of a bigger matrix, so submatrices
+     * (tiles) are addressed without any copies. Iterating over the view yields rows as "std::span<T>",
+     * so view satisfies 'Matrix' concept.
+     * @tparam T element type, may be const-qualified
+     */
+    template <typename T>
+    class MatrixView
+    {
+    private:
+        T *m_data{nullptr};
+        size_t m_rows{}, m_cols{}, m_stride{};
+
+    public:
+        /// @brief Forward iterator over rows of the view
+        class iterator
+        {
+        private:
+            T *m_row{nullptr};
+            size_t m_cols{}, m_stride{};
+
+        public:
+            using value_type = std::span<T>;
+            using difference_type = std::ptrdiff_t;
+
+            iterator() = default;
+            iterator(T *row, size_t cols, size_t stride) : m_row(row), m_cols(cols), m_stride(stride) {}
+
+            std::span<T> operator*() const noexcept { return std::span<T>(m_row, m_cols); }
+            iterator &operator++() noexcept
+            {
+                m_row += m_stride;
+                return *this;
+            }
+            iterator operator++(int) noexcept
+            {
+                iterator tmp{*this};
+                ++*this;
+                return tmp;
+            }
+            bool operator==(iterator const &other) const noexcept { return m_row == other.m_row; }
+        };
+
+        constexpr MatrixView() = default;
+
+        /**
+         * @brief Constructs view of the matrix
+         * @param data pointer to the first element
+         * @param rows count of rows
+         * @param cols count of columns
+         * @param stride distance between beginnings of the neighbour rows (in elements), must be >= cols
+         */
+        constexpr MatrixView(T *data, size_t rows, size_t cols, size_t stride) noexcept
+            : m_data(data), m_rows(rows), m_cols(cols), m_stride(stride) {}
+
+        /// @brief Constructs view of the contiguous matrix (stride equals to count of columns)
+        constexpr MatrixView(T *data, size_t rows, size_t cols) noexcept : MatrixView(data, rows, cols, cols) {}
+
+        /// @brief Implicit conversion to the view of constant elements
+        constexpr operator MatrixView<T const>() const noexcept { return MatrixView<T const>(m_data, m_rows, m_cols, m_stride); }
+
+        constexpr T *data() const noexcept { return m_data; }
+        constexpr size_t rows() const noexcept { return m_rows; }
+        constexpr size_t cols() const noexcept { return m_cols; }
+        constexpr size_t stride() const noexcept { return m_stride; }
+        constexpr size_t size() const noexcept { return m_rows; }
+        constexpr bool empty() const noexcept { return m_rows == 0ul || m_cols == 0ul; }
+
+        /// @brief Checks if there are no gaps between rows
+        constexpr bool contiguous() const noexcept { return m_stride == m_cols || m_rows <= 1ul; }
+
+        constexpr T &operator()(size_t row, size_t col) const noexcept { return m_data[row * m_stride + col]; }
+        constexpr std::span<T> operator[](size_t row) const noexcept { return std::span<T>(m_data + row * m_stride, m_cols); }
+
+        /**
+         * @brief Returns view of the rectangular part of the matrix
+         * @param row first row
+         * @param col first column
+         * @param rows count of rows
+         * @param cols count of columns
+         */
+        constexpr MatrixView submatrix(size_t row, size_t col, size_t rows, size_t cols) const
+        {
+            if (row + rows > m_rows || col + cols > m_cols)
+                throw std::out_of_range("MatrixView::submatrix(): submatrix is out of range");
+            return MatrixView(m_data + row * m_stride + col, rows, cols, m_stride);
+        }
+
+        iterator begin() const noexcept { return iterator(m_data, m_cols, m_stride); }
+        iterator end() const noexcept { return iterator(m_data + m_rows * m_stride, m_cols, m_stride); }
+    };
+
+    /**
+     * @brief Dense matrix stored contiguously in row-major order within a single allocation.
+     * Rows are accessible as "std::span<T>" (so matrix satisfies 'Matrix' concept and works with
+     * the functions for "std::vector<std::vector<T>>"), elements - with 'operator()(row, col)'.
+     * @tparam T element type
+     *
+     * Example of usage:
+     * DenseMatrix<int> m(3, 4);
+     * m(1, 2) = 5;
+     * auto t{algorithm::transpose(m)};
+     */
+    template <typename T>
+    class DenseMatrix
+    {
+    private:
+        std::vector<T> m_data;
+        size_t m_rows{}, m_cols{};
+
+    public:
+        DenseMatrix() = default;
+
+        /**
+         * @brief Constructs matrix 'rows' x 'cols' filled with 'value'
+         * @param rows count of rows
+         * @param cols count of columns
+         * @param value value for all elements
+         */
+        DenseMatrix(size_t rows, size_t cols, T const &value = T{})
+            : m_data(rows * cols, value), m_rows(rows), m_cols(cols) {}
+
+        /**
+         * @brief Takes ownership of the row-major array without copying
+         * (e.g. result of 'convert::matrixToArr()')
+         * @param rows count of rows
+         * @param cols count of columns
+         * @param data array of elements, size must be 'rows' * 'cols'
+         */
+        DenseMatrix(size_t rows, size_t cols, std::vector<T> data)
+            : m_data(std::move(data)), m_rows(rows), m_cols(cols)
+        {
+            if (m_data.size() != rows * cols)
+                throw std::invalid_argument("DenseMatrix: size of the array doesn't match size of the matrix");
+        }
+
+        /**
+         * @brief Copies any matrix that satisfies 'Matrix' concept (e.g. "std::vector<std::vector<T>>")
+         * @param matrix matrix with rows of the same length
+         * @return Dense copy of the matrix
+         */
+        template <typename M>
+            requires Matrix<M, T>
+        static DenseMatrix fromRows(M const &matrix)
+        {
+            DenseMatrix res;
+            res.m_rows = std::ranges::size(matrix);
+            res.m_cols = (res.m_rows != 0ul) ? std::ranges::size(*std::ranges::begin(matrix)) : 0ul;
+            res.m_data.reserve(res.m_rows * res.m_cols);
+            for (auto const &row : matrix)
+            {
+                if (std::ranges::size(row) != res.m_cols)
+                    throw std::invalid_argument("DenseMatrix::fromRows(): rows have different lengths");
+                res.m_data.insert(res.m_data.end(), std::ranges::begin(row), std::ranges::end(row));
+            }
+            return res;
+        }
+
+        /// @brief Copies matrix to the "std::vector<std::vector<T>>"
+        std::vector<std::vector<T>> toRows() const
+        {
+            std::vector<std::vector<T>> res;
+            res.reserve(m_rows);
+            for (auto const row : *this)
+                res.emplace_back(row.begin(), row.end());
+            return res;
+        }
+
+        /// @brief Gives away row-major array of elements without copying, matrix becomes empty
+        std::vector<T> release() noexcept
+        {
+            m_rows = m_cols = 0ul;
+            return std::move(m_data);
+        }
+
+        T *data() noexcept { return m_data.data(); }
+        T const *data() const noexcept { return m_data.data(); }
+        size_t rows() const noexcept { return m_rows; }
+        size_t cols() const noexcept { return m_cols; }
+        size_t size() const noexcept { return m_rows; }
+        bool empty() const noexcept { return m_data.empty(); }
+
+        T &operator()(size_t row, size_t col) noexcept { return m_data[row * m_cols + col]; }
+        T const &operator()(size_t row, size_t col) const noexcept { return m_data[row * m_cols + col]; }
+
+        std::span<T> operator[](size_t row) noexcept { return std::span<T>(m_data.data() + row * m_cols, m_cols); }
+        std::span<T const> operator[](size_t row) const noexcept { return std::span<T const>(m_data.data() + row * m_cols, m_cols); }
+
+        /// @brief Element access with bounds checking
+        T &at(size_t row, size_t col)
+        {
+            if (row >= m_rows || col >= m_cols)
+                throw std::out_of_range("DenseMatrix::at(): index is out of range");
+            return (*this)(row, col);
+        }
+        T const &at(size_t row, size_t col) const { return const_cast<DenseMatrix &>(*this).at(row, col); }
+
+        MatrixView<T> view() noexcept { return MatrixView<T>(m_data.data(), m_rows, m_cols); }
+        MatrixView<T const> view() const noexcept { return MatrixView<T const>(m_data.data(), m_rows, m_cols); }
+        operator MatrixView<T>() noexcept { return view(); }
+        operator MatrixView<T const>() const noexcept { return view(); }
+
+        typename MatrixView<T>::iterator begin() noexcept { return view().begin(); }
+        typename MatrixView<T>::iterator end() noexcept { return view().end(); }
+        typename MatrixView<T const>::iterator begin() const noexcept { return view().begin(); }
+        typename MatrixView<T const>::iterator end() const noexcept { return view().end(); }
+
+        // Element-wise operations work on the whole contiguous array, so compiler can vectorize them
+        DenseMatrix &operator+=(DenseMatrix const &other)
+        {
+            checkSameShape(other);
+            std::transform(m_data.cbegin(), m_data.cend(), other.m_data.cbegin(), m_data.begin(), std::plus<>{});
+            return *this;
+        }
+        DenseMatrix &operator-=(DenseMatrix const &other)
+        {
+            checkSameShape(other);
+            std::transform(m_data.cbegin(), m_data.cend(), other.m_data.cbegin(), m_data.begin(), std::minus<>{});
+            return *this;
+        }
+        DenseMatrix &operator*=(T const &scalar)
+        {
+            for (T &el : m_data)
+                el *= scalar;
+            return *this;
+        }
+
+        friend DenseMatrix operator+(DenseMatrix lhs, DenseMatrix const &rhs) { return lhs += rhs; }
+        friend DenseMatrix operator-(DenseMatrix lhs, DenseMatrix const &rhs) { return lhs -= rhs; }
+        friend DenseMatrix operator*(DenseMatrix lhs, T const &scalar) { return lhs *= scalar; }
+        friend bool operator==(DenseMatrix const &, DenseMatrix const &) = default;
+
+    private:
+        void checkSameShape(DenseMatrix const &other) const
+        {
+            if (m_rows != other.m_rows || m_cols != other.m_cols)
+                throw std::invalid_argument("DenseMatrix: matrices have different shapes");
+        }
+    };
+
     namespace print
     {
+        /**
+         * @brief Destination of the print functions: file descriptor, 'FILE*', output stream or string.
+         * Converts implicitly, so every print function accepts e.g. 'std::cerr', 'stderr', 'STDOUT_FILENO' or 'std::string &'.
+         */
+        class Output
+        {
+        private:
+            std::variant<int, std::FILE *, std::ostream *, std::string *> m_target;
+
+        public:
+            /// @brief Writes to 'std::cout'
+            Output() noexcept : m_target(&std::cout) {}
+            Output(int fd) noexcept : m_target(fd) {}
+            Output(std::FILE *file) noexcept : m_target(file) {}
+            Output(std::ostream &os) noexcept : m_target(&os) {}
+            Output(std::string &str) noexcept : m_target(&str) {}
+
+            /**
+             * @brief Writes the whole data by the single call (retries partial writes of the file descriptor)
+             * @throw std::system_error when writing to the file descriptor or 'FILE*' fails
+             */
+            void write(std::string_view data) const;
+        };
+
+        /**
+         * @brief Formats values into the buffer reused between the calls on the same thread and passes the
+         * result to the output by the single write in 'flush()' (or every 'kFlushThreshold' bytes).
+         * Numbers are formatted with 'std::to_chars', types with 'std::formatter' with 'std::format_to',
+         * the rest with their 'operator<<'. Unflushed data is discarded by the destructor.
+         */
+        class Writer
+        {
+        public:
+            static constexpr size_t kFlushThreshold{1ul << 20ul};
+
+        private:
+            struct StreamAdapter;
+
+            Output m_output;
+            std::string m_buffer;
+            std::unique_ptr<StreamAdapter> m_stream; // Created on the first value printed by 'operator<<'
+
+            std::ostream &stream();
+
+        public:
+            explicit Writer(Output output = {});
+            ~Writer();
+            Writer(Writer const &) = delete;
+            Writer &operator=(Writer const &) = delete;
+
+            template <typename T>
+            Writer &operator<<(T const &value)
+            {
+                append(value);
+                if (m_buffer.size() >= kFlushThreshold)
+                    flush();
+                return *this;
+            }
+
+            /// @brief Appends value without the check of the threshold
+            template <typename T>
+            void append(T const &value)
+            {
+                if constexpr (std::is_same_v<T, bool>)
+                    m_buffer.push_back(value ? '1' : '0');
+                else if constexpr (std::is_same_v<T, char> || std::is_same_v<T, signed char> || std::is_same_v<T, unsigned char>)
+                    m_buffer.push_back(static_cast<char>(value));
+                else if constexpr (std::is_arithmetic_v<T>)
+                {
+                    std::array<char, 128ul> digits;
+                    auto const result{std::to_chars(digits.data(), digits.data() + digits.size(), value)};
+                    m_buffer.append(digits.data(), result.ptr);
+                }
+                else if constexpr (std::is_convertible_v<T const &, std::string_view>)
+                    m_buffer.append(std::string_view(value));
+                else if constexpr (std::is_default_constructible_v<std::formatter<T, char>>)
+                    std::format_to(std::back_inserter(m_buffer), "{}", value);
+                else
+                    stream() << value;
+            }
+
+            /// @brief Appends 'count' copies of the character
+            void fill(size_t count, char ch = ' ') { m_buffer.append(count, ch); }
+
+            /// @brief Text formatted so far and not written yet
+            std::string_view buffered() const noexcept { return m_buffer; }
+            size_t size() const noexcept { return m_buffer.size(); }
+
+            /// @brief Drops the last 'count' characters of the buffered text
+            void truncate(size_t count) noexcept { m_buffer.resize(m_buffer.size() - std::min(count, m_buffer.size())); }
+
+            /// @brief Writes buffered text to the output
+            void flush();
+        };
+
+        /// @brief Layout of the matrix: as is with the separator after each element or by the columns
+        /// of the same width (numbers are aligned to the right)
+        enum class MatrixLayout
+        {
+            Plain,
+            Aligned
+        };
+
+        namespace detail
+        {
+            template <typename Iter>
+            void writeRange(Writer &writer, Iter begin, Iter end)
+            {
+                for (auto iter{begin}; iter != end; ++iter)
+                    writer << *iter << ' ';
+                writer.append('\n');
+            }
+
+            template <typename M>
+            void writeMatrix(Writer &writer, M const &matrix, char separator, MatrixLayout layout)
+            {
+                if (layout == MatrixLayout::Plain)
+                {
+                    for (auto const &row : matrix)
+                    {
+                        for (auto const &el : row)
+                            writer << el << separator;
+                        writer.append('\n');
+                    }
+                    return;
+                }
+
+                // Formatting cells once to find the widths of the columns, then padding them in place
+                std::string scratch;
+                Writer cells(scratch);
+                std::vector<size_t> ends, widths, rowSizes;
+                for (auto const &row : matrix)
+                {
+                    size_t col{};
+                    for (auto const &el : row)
+                    {
+                        size_t const start{cells.size()};
+                        cells.append(el);
+                        ends.push_back(cells.size());
+                        if (col == widths.size())
+                            widths.push_back(0ul);
+                        widths[col] = std::max(widths[col], cells.size() - start);
+                        ++col;
+                    }
+                    rowSizes.push_back(col);
+                }
+
+                std::string_view const text{cells.buffered()};
+                size_t cell{}, start{};
+                for (size_t const cols : rowSizes)
+                {
+                    for (size_t col{}; col < cols; ++col, ++cell)
+                    {
+                        writer.fill(widths[col] - (ends[cell] - start) + (col == 0ul ? 0ul : 1ul));
+                        writer << text.substr(start, ends[cell] - start);
+                        start = ends[cell];
+                    }
+                    writer.append('\n');
+                }
+            }
+        }
+
         // Prints array to terminal
         template <typename T>
-        extern void printVec(std::vector<T> const &);
+        void printVec(std::vector<T> const &vec, Output output = {})
+        {
+            Writer writer(output);
+            detail::writeRange(writer, vec.cbegin(), vec.cend());
+            writer.flush();
+        }
 
         // Since C++20 (need std::span)
         // Prints range to terminal
         template <typename T>
-        void print_range(std::span<const T>);
+        void print_range(std::span<const T> range, Output output = {})
+        {
+            Writer writer(output);
+            detail::writeRange(writer, range.begin(), range.end());
+            writer.flush();
+        }
 
         // Prints range to terminal by iterators
         template <typename Iter>
-        void print_range(Iter, Iter);
+        void print_range(Iter begin, Iter end, Output output = {})
+        {
+            Writer writer(output);
+            detail::writeRange(writer, begin, end);
+            writer.flush();
+        }
 
-        // Prints matrix to terminal
+        // Prints matrix to terminal, elements are separated by tabs in the plain layout
         template <typename T>
-        void printMatrix(std::vector<std::vector<T>> const &);
+        void printMatrix(std::vector<std::vector<T>> const &matrix, MatrixLayout layout = MatrixLayout::Plain, Output output = {})
+        {
+            Writer writer(output);
+            detail::writeMatrix(writer, matrix, '\t', layout);
+            writer.flush();
+        }
 
         /**
          * @brief Prints matrix
          * @tparam matrix matrix to print
          */
         template <Printable T>
-        void printMatrix(Matrix<T> auto const &matrix);
+        void printMatrix(Matrix<T> auto const &matrix, MatrixLayout layout = MatrixLayout::Plain, Output output = {})
+        {
+            Writer writer(output);
+            detail::writeMatrix(writer, matrix, ' ', layout);
+            writer.flush();
+        }
 
         // Prints vector of pairs to terminal
         template <typename T1, typename T2>
-        void print_pair_vec(const std::vector<std::pair<T1, T2>> &);
+        void print_pair_vec(const std::vector<std::pair<T1, T2>> &vec, Output output = {})
+        {
+            Writer writer(output);
+            for (auto const &[first, second] : vec)
+                writer << "array[" << first << "] = " << second << '\n';
+            writer.flush();
+        }
 
         // Prints dictionary to terminal (need std::map)
         template <typename T1, typename T2>
-        void print_dictionary(const std::map<T1, T2> &);
+        void print_dictionary(const std::map<T1, T2> &dictionary, Output output = {})
+        {
+            Writer writer(output);
+            for (auto const &[key, value] : dictionary)
+                writer << key << " - " << value << '\n';
+            writer.flush();
+        }
 
-        // Prints tuple to terminal (need std::tuple)
+        // Prints tuple to terminal (need std::tuple), each element on the separate line
         template <typename TupleType, size_t TupleSize = std::tuple_size<TupleType>::value>
-        void printTuple(const TupleType &);
+        void printTuple(const TupleType &t, Output output = {})
+        {
+            Writer writer(output);
+            [&]<size_t... I>(std::index_sequence<I...>)
+            { ((writer << std::get<I>(t) << '\n'), ...); }(std::make_index_sequence<TupleSize>{});
+            writer.flush();
+        }
     }
 
     namespace checkings
     {
+        /// @brief Kind of the number: "42", "-42" (or "+42"), "-4.2", "4.2e-1" or "0x2A"
+        enum class NumberKind : std::uint8_t
+        {
+            Invalid,
+            Unsigned,
+            Signed,
+            Decimal,
+            Scientific,
+            Hex
+        };
+
+        /// @brief Optional parts of the number syntax
+        struct NumberSyntax
+        {
+            bool hex{false};        // "0x1F" and "-0X1f"
+            bool separators{false}; // Single '_' between two digits: "1_000_000", "0.000_1"
+        };
+
+        /// @brief Result of 'parseNumber()'
+        struct NumberToken
+        {
+            NumberKind kind{NumberKind::Invalid};
+            size_t length{};           // Length of the longest prefix that is a number, 0 if there is no such prefix
+            bool negative{};
+            bool overflow{};           // Integer doesn't fit into 64 bits or floating number is out of range of 'double'
+            std::uint64_t magnitude{}; // Absolute value of the 'Unsigned', 'Signed' and 'Hex' numbers
+            double value{};            // Value of any kind (integers are rounded to the nearest 'double')
+        };
+
+        /**
+         * @brief Finds the longest prefix of the string that is a number, classifies and converts it in one pass
+         * by the table-driven automaton (the floating point value is converted by 'std::from_chars' afterwards).
+         * Leading '.' and trailing '.' ("0.5" may be written as ".5", "5.0" as "5.") are allowed, whitespace isn't.
+         */
+        NumberToken parseNumber(std::string_view str, NumberSyntax syntax = {}) noexcept;
+
+        /**
+         * @brief Kind of the string if it's a number entirely, otherwise 'NumberKind::Invalid'.
+         * Plain integers and decimals ("-12", "1.5") are checked by 16 bytes at a time with SSE2, the rest by the automaton.
+         */
+        NumberKind classifyNumber(std::string_view str, NumberSyntax syntax = {}) noexcept;
+
+        /// @brief Classifies every field of the column (see 'classifyNumber()')
+        std::vector<NumberKind> classifyNumbers(std::span<std::string_view const> fields, NumberSyntax syntax = {});
+
         // Returns true if string is a unsigned integer number (unsigned short, unsigned int, size_t, etc.)
         bool is_uint_number(const std::string &);
 
         // Returns true if string is a signed integer number (short, int, long, etc.)
         bool is_int_number(const std::string &);
 
-        // Returns true if string is a floating number (float, double, etc.)
+        // Returns true if string is a floating number (float, double, etc.), exponent is allowed
         bool is_floating_number(const std::string &);
 
         // Returns true if both are equals
@@ -285,20 +840,89 @@ namespace lvt
         consteval bool isArithmeticType([[maybe_unused]] const T &) noexcept;
 
         /**
-         * @brief Checker for bracket sequence that could include: ()[]{}
+         * @brief Checker for bracket sequence that could include: ()[]{}, other characters are ignored
          * @param seq sequence of brackets
-         * @return `true` if sequence is valid, otherwise - `false`
+         * @return `true` if sequence is valid, otherwise (or if it's empty) - `false`
          */
         bool isBracketSequenceValid(std::string_view seq);
+
+        /**
+         * @brief Validates brackets ()[]{} of the input given by chunks, other bytes are ignored.
+         * Chunks are scanned by 64 bytes at a time with SSE2, so runs without brackets are skipped quickly.
+         * Open brackets are kept in the inline stack of 'kInlineDepth' and the deeper ones in the heap.
+         *
+         * Example of usage:
+         * BracketValidator validator;
+         * for (std::string_view chunk : chunks)
+         *     if (!validator.feed(chunk))
+         *         break;
+         * if (!validator.finish())
+         *     std::cerr << "Broken brackets at " << *validator.errorOffset() << '\n';
+         */
+        class BracketValidator
+        {
+        public:
+            static constexpr size_t kInlineDepth{64ul};
+
+        private:
+            std::array<char, kInlineDepth> m_inline; // Expected closing brackets of the bottom of the stack
+            std::vector<char> m_spill;                // Expected closing brackets above 'kInlineDepth'
+            size_t m_depth{};
+            size_t m_offset{}; // Count of the bytes fed
+            std::optional<size_t> m_error;
+
+            // Handles one character at the 'offset' of the input, returns false on error
+            bool step(char ch, size_t offset);
+
+        public:
+            /// @return false if the sequence is broken (by this or by one of the previous chunks)
+            bool feed(std::string_view chunk);
+
+            /// @brief Ends the input: brackets that are still open are an error at the end of the input
+            /// @return true if the whole input is valid
+            bool finish() noexcept;
+
+            /// @brief Offset of the unmatched closing bracket (or of the end of the input for unclosed ones)
+            std::optional<size_t> errorOffset() const noexcept { return m_error; }
+
+            /// @brief Count of the currently open brackets
+            size_t depth() const noexcept { return m_depth; }
+
+            void reset() noexcept;
+        };
+
+        /// @brief Offset of the first error of the brackets ()[]{} (see 'BracketValidator'), nothing if they are valid
+        std::optional<size_t> findBracketError(std::string_view seq);
     }
 
     namespace convert
     {
-        // Returns string parameter as T
+        /**
+         * @brief Parses the whole string (surrounding whitespace is allowed) as 'T'.
+         * Numbers are parsed by 'std::from_chars', integers up to 64 bits by the 8 digits per step,
+         * strings are copied and other types are read by 'operator>>'.
+         * @return value, 'std::errc::invalid_argument' if the string isn't a 'T' entirely or
+         * 'std::errc::result_out_of_range' if the number doesn't fit into 'T'
+         */
+        template <typename T>
+        std::expected<T, std::errc> fromString(std::string_view str) noexcept(CharconvNumber<T>);
+
+        // Returns string parameter as T, 'T{}' if it can't be parsed (see 'fromString()')
         template <typename T>
         T str_to_T(const std::string &);
 
-        // Returns 'T' as string
+        /**
+         * @brief Writes number to [first, last) by 'std::to_chars' (shortest round-trip form for floating point)
+         * @return pointer past the last written character, nullptr if the range is too small
+         */
+        template <typename T>
+        char *toChars(char *first, char *last, T const &value) noexcept;
+
+        // Returns 'T' as string: numbers by 'std::to_chars', other types by 'operator<<'
+        template <typename T>
+        std::string toString(T const &value);
+
+        // Returns 'T' as string (see 'toString()')
         template <typename T>
         std::string T_to_str(const T &);
 
@@ -367,17 +991,159 @@ namespace lvt
 
     namespace input
     {
+        namespace detail
+        {
+            // Asks until the input passes 'isValid' and fits into 'T'
+            template <typename T>
+            T inputNumber(const char *msg, bool (*isValid)(std::string const &), const char *error)
+            {
+                std::string users_input;
+                while (true)
+                {
+                    std::cout << msg;
+                    if (!(std::cin >> users_input))
+                        throw std::runtime_error("input: standard input is closed");
+
+                    if (isValid(users_input))
+                        if (auto const num{convert::fromString<T>(users_input)})
+                            return *num;
+                    std::cout << error;
+                }
+            }
+        }
+
         // Returns user's input as unsigned integer number
         template <typename T>
-        T input_to_uint(const char *msg = "");
+        T input_to_uint(const char *msg = "")
+        {
+            return detail::inputNumber<T>(msg, checkings::is_uint_number, "You entered not an unsigned integer number. Try again.\n");
+        }
 
         // Returns user's input as signed integer number
         template <typename T>
-        T input_to_int(const char *msg = "");
+        T input_to_int(const char *msg = "")
+        {
+            return detail::inputNumber<T>(msg, checkings::is_int_number, "You entered not an signed integer number. Try again.\n");
+        }
 
         // Returns user's input as floating number
         template <typename T>
-        T input_to_floating(const char *msg = "");
+        T input_to_floating(const char *msg = "")
+        {
+            return detail::inputNumber<T>(msg, checkings::is_floating_number, "You entered not an floating number. Try again.\n");
+        }
+
+        /// @brief Why 'Reader' couldn't return the value
+        struct ReadError
+        {
+            enum class Kind : std::uint8_t
+            {
+                EndOfInput,
+                Invalid,    // Token isn't a value of the requested type
+                OutOfRange, // Number doesn't fit into the requested type
+                Io
+            };
+
+            Kind kind{Kind::EndOfInput};
+            size_t offset{};   // Offset of the token (of the end of the input for 'EndOfInput') from the beginning of the input
+            std::string token; // Text of the token for 'Invalid' and 'OutOfRange'
+            int error{};       // 'errno' for 'Io'
+        };
+
+        /**
+         * @brief Reads whitespace-separated values in bulk from the file descriptor, stream or memory.
+         * Input is read by big blocks directly (through 'read(2)' or the stream buffer, bypassing formatted input
+         * of the streams), whitespace is skipped by 16 bytes at a time with SSE2 and values are parsed by
+         * 'convert::fromString()'. Reader buffers input, so don't mix it with other reads of the same source.
+         *
+         * Example of usage:
+         * lvt::input::Reader in;
+         * auto const n{in.read<size_t>().value()};
+         * std::vector<int> values(n);
+         * if (auto const count{in.read(std::span(values))}; !count || *count != n)
+         *     return 1;
+         */
+        class Reader
+        {
+        private:
+            struct Impl;
+            std::unique_ptr<Impl> m_impl;
+
+            ReadError tokenError(std::string_view token, std::errc ec) const;
+
+        public:
+            static constexpr size_t kDefaultBufferSize{1ul << 18ul};
+
+            /// @param fd file descriptor, standard input by default
+            explicit Reader(int fd = 0, size_t bufferSize = kDefaultBufferSize);
+            /// @param is stream, only characters that are available without blocking are taken from it at once
+            explicit Reader(std::istream &is, size_t bufferSize = kDefaultBufferSize);
+
+            /// @brief Reads from memory without copying, data must outlive the reader
+            static Reader fromMemory(std::string_view data);
+
+            Reader(Reader &&) noexcept;
+            Reader &operator=(Reader &&) noexcept;
+            ~Reader();
+
+            /// @brief Next whitespace-separated token, it's valid until the next call
+            std::expected<std::string_view, ReadError> token();
+
+            /// @brief Next token parsed as 'T' (see 'convert::fromString()')
+            template <typename T>
+            std::expected<T, ReadError> read()
+            {
+                auto const tok{token()};
+                if (!tok)
+                    return std::unexpected(tok.error());
+                auto const value{convert::fromString<T>(*tok)};
+                if (!value)
+                    return std::unexpected(tokenError(*tok, value.error()));
+                return *value;
+            }
+
+            /**
+             * @brief Fills 'values' by the next tokens
+             * @return Count of the read values, less than the size of 'values' only at the end of the input
+             */
+            template <typename T>
+            std::expected<size_t, ReadError> read(std::span<T> values)
+            {
+                for (size_t i{}; i < values.size(); ++i)
+                {
+                    auto value{read<T>()};
+                    if (!value)
+                    {
+                        if (value.error().kind == ReadError::Kind::EndOfInput)
+                            return i;
+                        return std::unexpected(std::move(value.error()));
+                    }
+                    values[i] = std::move(*value);
+                }
+                return values.size();
+            }
+
+            /// @brief Reads values up to the end of the input
+            template <typename T>
+            std::expected<std::vector<T>, ReadError> readAll()
+            {
+                std::vector<T> values;
+                while (true)
+                {
+                    auto value{read<T>()};
+                    if (!value)
+                    {
+                        if (value.error().kind == ReadError::Kind::EndOfInput)
+                            return values;
+                        return std::unexpected(std::move(value.error()));
+                    }
+                    values.push_back(std::move(*value));
+                }
+            }
+
+            /// @brief Count of the bytes consumed from the beginning of the input
+            size_t offset() const noexcept;
+        };
     }
 
     namespace random
@@ -385,11 +1151,13 @@ namespace lvt
         // Returns one random double number
         double create_random_double(const double &__lower = 0.0, const double &__upper = 10.0);
 
-        // Returns random string
-        /* Hint: You must declare at the top following line:
+        // Returns random string of the specified length
+        /* Hint: alphabet is chosen when the library is built:
             #define __GENERATE__ALL__SYMBOLS__ for generate string consisting of all symbols
             or
-            #define __GENERATE__ONLY__DIGITS__ for generate string consisting of only digits */
+            #define __GENERATE__ONLY__DIGITS__ for generate number without leading zeros
+            otherwise string consists of letters and digits.
+            Prefer 'generateRandomString<alphabet>(size_t)' that takes alphabet as a template parameter */
         std::string generateRandomString(size_t);
 
         // Returns random vector filled with integer numbers
@@ -398,7 +1166,7 @@ namespace lvt
         // 'to' - higher number to generate
         std::vector<int> generateRandomIntVector(size_t vecSize = 10UL, int from = -50, int to = 50);
 
-        // Returns matrix of integers that is filled with random numbers
+        // Returns matrix of integers that is filled with random numbers from [offset; offset + range - 1]
         // Gets rows as a first parameter and columns as a second
         // Third param - offset, fourth - range
         std::vector<std::vector<int>> generateRandomIntMatrix(size_t rows, size_t cols,
@@ -411,27 +1179,505 @@ namespace lvt
          * @param to max value to generate
          */
         void fillVector(std::vector<int> &v, int from = 0, int to = 100);
-    }
 
-    namespace algorithm
-    {
-        namespace sorting
+        /// @brief SplitMix64 step, expands one 64-bit seed into a sequence of well-mixed words for seeding
+        constexpr std::uint64_t splitmix64(std::uint64_t &state) noexcept
         {
-            // Sorting 1d array by bubble sorting algorithm
-            template <typename T>
-            constexpr void bubbleSortAscending(std::vector<T> &);
+            std::uint64_t z{state += 0x9E37'79B9'7F4A'7C15ull};
+            z = (z ^ (z >> 30u)) * 0xBF58'476D'1CE4'E5B9ull;
+            z = (z ^ (z >> 27u)) * 0x94D0'49BB'1331'11EBull;
+            return z ^ (z >> 31u);
+        }
 
-            // Sorting 2d array by bubble sorting algorithm
-            template <typename T>
-            constexpr void bubbleSort2DAscending(std::vector<std::vector<T>> &);
+        /**
+         * @brief xoshiro256** generator: 256 bits of state, period 2^256 - 1, a few cycles per number.
+         * Satisfies "std::uniform_random_bit_generator", so it works with standard distributions.
+         */
+        class Xoshiro256StarStar
+        {
+        private:
+            std::uint64_t m_state[4];
 
-            // Sorting elems in vector. Best case - O(n). Middle and worst cases - O(n^2)
-            template <typename T>
-            constexpr void insertionSortAscending(std::vector<T> &);
+        public:
+            using result_type = std::uint64_t;
 
-            // Sorting 2d array by insertion sorting algorithm
-            template <typename T>
-            constexpr void insertionSort2DAscending(std::vector<std::vector<T>> &);
+            /// @brief State is expanded from the seed by SplitMix64, so any seed (even 0) is valid
+            constexpr explicit Xoshiro256StarStar(std::uint64_t seed = 0ull) noexcept : m_state{}
+            {
+                for (auto &word : m_state)
+                    word = splitmix64(seed);
+            }
+
+            static constexpr result_type min() noexcept { return 0ull; }
+            static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+            constexpr result_type operator()() noexcept
+            {
+                std::uint64_t const res{std::rotl(m_state[1] * 5ull, 7) * 9ull}, t{m_state[1] << 17u};
+                m_state[2] ^= m_state[0];
+                m_state[3] ^= m_state[1];
+                m_state[1] ^= m_state[2];
+                m_state[0] ^= m_state[3];
+                m_state[2] ^= t;
+                m_state[3] = std::rotl(m_state[3], 45);
+                return res;
+            }
+
+            /// @brief Advances state by 2^128 steps: gives 2^128 non-overlapping streams for parallel work
+            constexpr void jump() noexcept
+            {
+                constexpr std::uint64_t kJump[]{0x180E'C6D3'3CFD'0ABAull, 0xD5A6'1266'F0C9'392Cull,
+                                                0xA958'2618'E03F'C9AAull, 0x39AB'DC45'29B1'661Cull};
+                std::uint64_t s[4]{};
+                for (std::uint64_t jump : kJump)
+                    for (unsigned bit{}; bit < 64u; bit++)
+                    {
+                        if (jump & (1ull << bit))
+                            for (size_t i{}; i < 4ul; i++)
+                                s[i] ^= m_state[i];
+                        (*this)();
+                    }
+                std::copy_n(s, 4ul, m_state);
+            }
+
+            constexpr void discard(unsigned long long count) noexcept
+            {
+                for (; count != 0ull; --count)
+                    (*this)();
+            }
+
+            friend constexpr bool operator==(Xoshiro256StarStar const &, Xoshiro256StarStar const &) = default;
+        };
+
+        /// @brief PCG64 (XSL RR 128/64): 128-bit LCG with permuted output, 2^127 independent streams
+        class Pcg64
+        {
+        private:
+            static constexpr uint128_t kMultiplier{(static_cast<uint128_t>(0x2360'ED05'1FC6'5DA4ull) << 64u) |
+                                                   0x4385'DF64'9FCC'F645ull};
+            uint128_t m_state{}, m_increment{};
+
+        public:
+            using result_type = std::uint64_t;
+
+            /**
+             * @param seed initial state
+             * @param stream number of the stream, generators with different streams give independent sequences
+             */
+            constexpr explicit Pcg64(std::uint64_t seed = 0ull, std::uint64_t stream = 0ull) noexcept
+                : m_increment((static_cast<uint128_t>(stream) << 1u) | 1u)
+            {
+                (*this)();
+                m_state += seed;
+                (*this)();
+            }
+
+            static constexpr result_type min() noexcept { return 0ull; }
+            static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+            constexpr result_type operator()() noexcept
+            {
+                m_state = m_state * kMultiplier + m_increment;
+                return std::rotr(static_cast<std::uint64_t>(m_state >> 64u) ^ static_cast<std::uint64_t>(m_state),
+                                 static_cast<int>(m_state >> 122u));
+            }
+
+            /// @brief Jumps over 'count' numbers in O(log(count)) by composition of the LCG steps
+            constexpr void discard(unsigned long long count) noexcept
+            {
+                uint128_t mul{kMultiplier}, add{m_increment}, accMul{1u}, accAdd{0u};
+                for (; count != 0ull; count >>= 1u)
+                {
+                    if (count & 1ull)
+                    {
+                        accMul *= mul;
+                        accAdd = accAdd * mul + add;
+                    }
+                    add *= mul + 1u;
+                    mul *= mul;
+                }
+                m_state = accMul * m_state + accAdd;
+            }
+
+            friend constexpr bool operator==(Pcg64 const &, Pcg64 const &) = default;
+        };
+
+        /**
+         * @brief Philox4x32-10 counter-based generator: number with index 'i' is a bijective hash of
+         * (key, i), so there is no state besides the counter. Any position of the sequence is reachable in O(1)
+         * and every thread (or task) may generate its own part of the sequence without coordination.
+         */
+        class Philox4x32
+        {
+        public:
+            using counter_type = std::array<std::uint32_t, 4ul>;
+            using key_type = std::array<std::uint32_t, 2ul>;
+
+        private:
+            key_type m_key{};
+            std::uint64_t m_stream{};    // High half of the counter
+            std::uint64_t m_block{};     // Index of the next block of 4 words, low half of the counter
+            counter_type m_buffer{};     // Current block
+            unsigned m_position{4u};     // Position of the next unread 64-bit half in 'm_buffer': 0, 2 or 4
+
+        public:
+            using result_type = std::uint64_t;
+
+            /**
+             * @param seed key of the generator
+             * @param stream high half of the counter, generators with different streams never overlap
+             */
+            constexpr explicit Philox4x32(std::uint64_t seed = 0ull, std::uint64_t stream = 0ull) noexcept
+                : m_key{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32u)}, m_stream(stream) {}
+
+            static constexpr result_type min() noexcept { return 0ull; }
+            static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+            /// @brief Ten rounds of Philox bijection of the counter with the key
+            static constexpr counter_type block(counter_type ctr, key_type key) noexcept
+            {
+                constexpr std::uint32_t kMul0{0xD251'1F53u}, kMul1{0xCD9E'8D57u}, kWeyl0{0x9E37'79B9u}, kWeyl1{0xBB67'AE85u};
+                std::uint32_t c0{ctr[0]}, c1{ctr[1]}, c2{ctr[2]}, c3{ctr[3]}, k0{key[0]}, k1{key[1]};
+                for (int round{}; round < 10; round++)
+                {
+                    std::uint64_t const p0{static_cast<std::uint64_t>(kMul0) * c0}, p1{static_cast<std::uint64_t>(kMul1) * c2};
+                    c0 = static_cast<std::uint32_t>(p1 >> 32u) ^ c1 ^ k0;
+                    c2 = static_cast<std::uint32_t>(p0 >> 32u) ^ c3 ^ k1;
+                    c1 = static_cast<std::uint32_t>(p1);
+                    c3 = static_cast<std::uint32_t>(p0);
+                    k0 += kWeyl0;
+                    k1 += kWeyl1;
+                }
+                return {c0, c1, c2, c3};
+            }
+
+            constexpr result_type operator()() noexcept
+            {
+                if (m_position == 4u)
+                {
+                    m_buffer = block({static_cast<std::uint32_t>(m_block), static_cast<std::uint32_t>(m_block >> 32u),
+                                      static_cast<std::uint32_t>(m_stream), static_cast<std::uint32_t>(m_stream >> 32u)},
+                                     m_key);
+                    ++m_block;
+                    m_position = 0u;
+                }
+                result_type const res{m_buffer[m_position] | (static_cast<std::uint64_t>(m_buffer[m_position + 1u]) << 32u)};
+                m_position += 2u;
+                return res;
+            }
+
+            /// @brief Jumps over 'count' numbers in O(1)
+            constexpr void discard(unsigned long long count) noexcept
+            {
+                std::uint64_t const index{m_block * 2ull - (4u - m_position) / 2u + count};
+                m_block = index / 2ull;
+                m_position = 4u;
+                if (index % 2ull != 0ull)
+                    (*this)();
+            }
+
+            friend constexpr bool operator==(Philox4x32 const &, Philox4x32 const &) = default;
+        };
+
+        /// @brief Engine used by the functions of 'lvt::random' that don't take an engine explicitly
+        using default_engine = Xoshiro256StarStar;
+
+        /**
+         * @brief Sets seed of the per-thread engines. Engine of each thread is lazily reseeded with the pair
+         * (seed, index of the thread), threads are indexed in order of their first call of 'threadEngine()'.
+         * Until the first call of 'seed()' engines are seeded from "std::random_device".
+         */
+        void seed(std::uint64_t value);
+
+        /// @brief Returns engine of the calling thread: no locks and no sharing between threads
+        default_engine &threadEngine();
+
+        /**
+         * @brief Returns uniformly distributed integer from [lo; hi] by Lemire's multiply-shift method:
+         * x * range / 2^64 without division, rare biased values of 'x' are rejected.
+         * @throw std::invalid_argument if lo > hi
+         */
+        template <std::integral T, std::uniform_random_bit_generator Engine>
+        T uniform(T lo, T hi, Engine &engine)
+        {
+            static_assert(Engine::min() == 0u && Engine::max() == std::numeric_limits<std::uint64_t>::max(),
+                          "Engine must generate 64-bit words");
+            if (lo > hi)
+                throw std::invalid_argument("random::uniform(): lower bound is greater than upper");
+
+            using U = std::make_unsigned_t<T>;
+            std::uint64_t const range{static_cast<std::uint64_t>(static_cast<U>(static_cast<U>(hi) - static_cast<U>(lo))) + 1ull};
+
+            // Full 64-bit range: every word is suitable
+            if (range == 0ull)
+                return static_cast<T>(engine());
+
+            uint128_t m{static_cast<uint128_t>(engine()) * range};
+            if (static_cast<std::uint64_t>(m) < range)
+                for (std::uint64_t const threshold{(0ull - range) % range}; static_cast<std::uint64_t>(m) < threshold;)
+                    m = static_cast<uint128_t>(engine()) * range;
+            return static_cast<T>(static_cast<U>(static_cast<U>(lo) + static_cast<U>(m >> 64u)));
+        }
+
+        /// @brief Returns uniformly distributed floating number from [lo; hi) with 53 (or 24 for "float") random bits
+        template <std::floating_point F, std::uniform_random_bit_generator Engine>
+        F uniform(F lo, F hi, Engine &engine)
+        {
+            constexpr int kBits{std::numeric_limits<F>::digits < 64 ? std::numeric_limits<F>::digits : 64};
+            F const unit{static_cast<F>(engine() >> (64 - kBits)) / static_cast<F>(std::uint64_t{1} << (kBits - 1)) / F{2}};
+            return lo + (hi - lo) * unit;
+        }
+
+        /**
+         * @brief Fills range with uniformly distributed integers from [lo; hi] (see 'uniform()').
+         * Ranges up to 2^32 take two numbers from each 64-bit word. Raw words are generated by blocks, and then
+         * mapping of a block is a branchless loop that compiler vectorizes, rejected values are redrawn after.
+         * @throw std::invalid_argument if lo > hi
+         */
+        template <std::integral T, std::uniform_random_bit_generator Engine>
+        void fill_uniform(std::span<std::type_identity_t<T>> out, T lo, T hi, Engine &engine)
+        {
+            if (lo > hi)
+                throw std::invalid_argument("random::fill_uniform(): lower bound is greater than upper");
+
+            using U = std::make_unsigned_t<T>;
+            std::uint64_t const range{static_cast<std::uint64_t>(static_cast<U>(static_cast<U>(hi) - static_cast<U>(lo))) + 1ull};
+            if (range == 0ull || range > (1ull << 32u))
+            {
+                for (auto &el : out)
+                    el = uniform(lo, hi, engine);
+                return;
+            }
+
+            // Range 2^32 uses raw halves; 'threshold' is 2^32 mod range
+            bool const full{range == (1ull << 32u)};
+            std::uint32_t const range32{static_cast<std::uint32_t>(range)}, threshold{full ? 0u : (0u - range32) % range32};
+
+            constexpr size_t kBlock{256ul};
+            std::uint32_t raw[kBlock];
+            for (size_t pos{}; pos < out.size(); pos += kBlock)
+            {
+                size_t const count{std::min(kBlock, out.size() - pos)};
+                for (size_t i{}; i < count; i += 2ul)
+                {
+                    std::uint64_t const word{engine()};
+                    raw[i] = static_cast<std::uint32_t>(word);
+                    raw[i + 1ul] = static_cast<std::uint32_t>(word >> 32u);
+                }
+
+                bool rejected{false};
+                for (size_t i{}; i < count; i++)
+                {
+                    std::uint64_t const m{full ? (static_cast<std::uint64_t>(raw[i]) << 32u) : static_cast<std::uint64_t>(raw[i]) * range32};
+                    out[pos + i] = static_cast<T>(static_cast<U>(static_cast<U>(lo) + static_cast<U>(m >> 32u)));
+                    rejected |= static_cast<std::uint32_t>(m) < threshold;
+                }
+
+                // Rejection is rare: probability is less than range / 2^32
+                if (rejected)
+                    for (size_t i{}; i < count; i++)
+                        if (static_cast<std::uint32_t>(static_cast<std::uint64_t>(raw[i]) * range32) < threshold)
+                            out[pos + i] = uniform(lo, hi, engine);
+            }
+        }
+
+        /// @brief Fills range with uniformly distributed floating numbers from [lo; hi)
+        template <std::floating_point F, std::uniform_random_bit_generator Engine>
+        void fill_uniform(std::span<std::type_identity_t<F>> out, F lo, F hi, Engine &engine)
+        {
+            for (auto &el : out)
+                el = uniform(lo, hi, engine);
+        }
+
+        /// @brief Same as 'uniform(lo, hi, engine)' with engine of the calling thread
+        template <typename T>
+            requires std::integral<T> || std::floating_point<T>
+        T uniform(T lo, T hi) { return uniform(lo, hi, threadEngine()); }
+
+        /// @brief Same as 'fill_uniform(out, lo, hi, engine)' with engine of the calling thread
+        template <typename T>
+            requires std::integral<T> || std::floating_point<T>
+        void fill_uniform(std::span<std::type_identity_t<T>> out, T lo, T hi) { fill_uniform(out, lo, hi, threadEngine()); }
+
+        /// @brief Count of elements generated by one stream of the parallel generators (part of their output contract)
+        inline constexpr size_t kParallelChunk{1ul << 16ul};
+
+        /**
+         * @brief Fills range in parallel and reproducibly: output is split into chunks of 'kParallelChunk' elements
+         * and chunk 'k' is generated by "Philox4x32(seed, k)", so the result depends only on the seed
+         * and is bit-identical for any count of threads.
+         * @throw std::invalid_argument if lo > hi
+         */
+        template <typename T>
+            requires std::integral<T> || std::floating_point<T>
+        void fill_uniform_parallel(std::span<std::type_identity_t<T>> out, T lo, T hi, std::uint64_t seed,
+                                   unsigned threads = std::thread::hardware_concurrency())
+        {
+            if (lo > hi)
+                throw std::invalid_argument("random::fill_uniform_parallel(): lower bound is greater than upper");
+
+            size_t const chunks{(out.size() + kParallelChunk - 1ul) / kParallelChunk};
+            auto const fillChunks{[out, lo, hi, seed](size_t first, size_t last)
+                                  {
+                                      for (size_t k{first}; k < last; k++)
+                                      {
+                                          Philox4x32 engine(seed, k);
+                                          size_t const offset{k * kParallelChunk};
+                                          fill_uniform(out.subspan(offset, std::min(kParallelChunk, out.size() - offset)), lo, hi, engine);
+                                      }
+                                  }};
+
+            threads = static_cast<unsigned>(std::clamp<size_t>(threads, 1ul, std::max(chunks, 1ul)));
+            if (threads == 1u)
+                return fillChunks(0ul, chunks);
+
+            // Every thread gets contiguous range of chunks
+            std::vector<std::jthread> workers;
+            workers.reserve(threads);
+            for (unsigned t{}; t < threads; t++)
+                workers.emplace_back(fillChunks, chunks * t / threads, chunks * (t + 1u) / threads);
+        }
+
+        /// @brief Returns vector of uniformly distributed numbers from [from; to] (see 'fill_uniform_parallel()')
+        template <typename T>
+            requires std::integral<T> || std::floating_point<T>
+        std::vector<T> generateRandomVector(size_t size, T from, T to, std::uint64_t seed,
+                                            unsigned threads = std::thread::hardware_concurrency())
+        {
+            std::vector<T> vec(size);
+            fill_uniform_parallel(std::span<T>(vec), from, to, seed, threads);
+            return vec;
+        }
+
+        /**
+         * @brief Returns matrix of uniformly distributed numbers from [from; to]. Elements are generated in
+         * row-major order as by 'generateRandomVector()', so the result doesn't depend on count of threads.
+         */
+        template <typename T>
+            requires std::integral<T> || std::floating_point<T>
+        DenseMatrix<T> generateRandomMatrix(size_t rows, size_t cols, T from, T to, std::uint64_t seed,
+                                            unsigned threads = std::thread::hardware_concurrency())
+        {
+            return DenseMatrix<T>(rows, cols, generateRandomVector(rows * cols, from, to, seed, threads));
+        }
+
+        /**
+         * @brief Returns string of symbols uniformly chosen from the alphabet, generated in parallel reproducibly
+         * (see 'fill_uniform_parallel()')
+         * @throw std::invalid_argument if alphabet is empty
+         */
+        std::string generateRandomString(size_t length, std::string_view alphabet, std::uint64_t seed,
+                                         unsigned threads = std::thread::hardware_concurrency());
+
+        /**
+         * @brief Compile-time alphabet: symbols of the string literal as a constexpr table.
+         * Used as a template parameter, e.g. "fillRandomString<"0123456789abcdef">(buf)".
+         */
+        template <size_t N>
+        struct Alphabet
+        {
+            static_assert(N > 1ul, "Alphabet must contain at least one symbol");
+
+            char symbols[N - 1ul]{};
+
+            consteval Alphabet(char const (&str)[N])
+            {
+                std::copy_n(str, N - 1ul, symbols);
+            }
+
+            static constexpr size_t size() noexcept { return N - 1ul; }
+            constexpr char operator[](size_t i) const noexcept { return symbols[i]; }
+
+            /**
+             * @brief Count of symbols that are taken from one 64-bit word: the largest 'k' such that size^k <= 2^32.
+             * Each symbol takes high part of word * size, the low part is reused for the next one,
+             * so bias of every symbol doesn't exceed 2^-32 without any rejections.
+             */
+            static constexpr size_t symbolsPerWord() noexcept
+            {
+                size_t k{};
+                for (std::uint64_t power{size()}; power <= (1ull << 32u) && k < 64ul; power *= size())
+                    ++k;
+                return std::max(k, 1ul);
+            }
+        };
+
+        namespace alphabets
+        {
+            inline constexpr Alphabet digits{"0123456789"};
+            inline constexpr Alphabet hex{"0123456789abcdef"};
+            inline constexpr Alphabet lower{"abcdefghijklmnopqrstuvwxyz"};
+            inline constexpr Alphabet upper{"ABCDEFGHIJKLMNOPQRSTUVWXYZ"};
+            inline constexpr Alphabet alnum{"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789"};
+            inline constexpr Alphabet symbols{"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz`1234567890-=~!@#$%^&*()_+[]{}\\|/\'\",.<>:; "};
+        }
+
+        /**
+         * @brief Writes random symbols of the alphabet to the caller's buffer without allocations.
+         * Several symbols are taken from each 64-bit word of the engine (see 'Alphabet::symbolsPerWord()').
+         * @tparam A alphabet, e.g. "alphabets::digits" or a string literal
+         * @param out destination, fully filled
+         * @param engine generator of 64-bit words
+         */
+        template <Alphabet A, std::uniform_random_bit_generator Engine>
+        void fillRandomString(std::span<char> out, Engine &engine)
+        {
+            static_assert(Engine::min() == 0u && Engine::max() == std::numeric_limits<std::uint64_t>::max(),
+                          "Engine must generate 64-bit words");
+            constexpr size_t kPerWord{A.symbolsPerWord()};
+
+            size_t pos{};
+            for (; pos + kPerWord <= out.size(); pos += kPerWord)
+            {
+                std::uint64_t word{engine()};
+                for (size_t i{}; i < kPerWord; i++)
+                {
+                    uint128_t const m{static_cast<uint128_t>(word) * A.size()};
+                    out[pos + i] = A[static_cast<size_t>(m >> 64u)];
+                    word = static_cast<std::uint64_t>(m);
+                }
+            }
+            for (std::uint64_t word{engine()}; pos < out.size(); pos++)
+            {
+                uint128_t const m{static_cast<uint128_t>(word) * A.size()};
+                out[pos] = A[static_cast<size_t>(m >> 64u)];
+                word = static_cast<std::uint64_t>(m);
+            }
+        }
+
+        /// @brief Same as 'fillRandomString(out, engine)' with engine of the calling thread
+        template <Alphabet A>
+        void fillRandomString(std::span<char> out) { fillRandomString<A>(out, threadEngine()); }
+
+        /// @brief Returns random string of the alphabet with specified length
+        template <Alphabet A>
+        std::string generateRandomString(size_t length)
+        {
+            std::string str(length, '\0');
+            fillRandomString<A>(str);
+            return str;
+        }
+    }
+
+    namespace algorithm
+    {
+        namespace sorting
+        {
+            // Sorting 1d array by bubble sorting algorithm
+            template <typename T>
+            constexpr void bubbleSortAscending(std::vector<T> &);
+
+            // Sorting 2d array by bubble sorting algorithm
+            template <typename T>
+            constexpr void bubbleSort2DAscending(std::vector<std::vector<T>> &);
+
+            // Sorting elems in vector. Best case - O(n). Middle and worst cases - O(n^2)
+            template <typename T>
+            constexpr void insertionSortAscending(std::vector<T> &);
+
+            // Sorting 2d array by insertion sorting algorithm
+            template <typename T>
+            constexpr void insertionSort2DAscending(std::vector<std::vector<T>> &);
 
             // Sorting vector by selection algorithm
             template <typename T>
@@ -706,97 +1952,1534 @@ namespace lvt
         std::vector<std::string> stringPermutations(std::string s);
 
         /**
-         * @brief Calculates 'n' elements from Tribonacci sequence by passes sequence
-         * @param signature sequence of integer elements
-         * @param n count of elements in the result sequence
-         * @return Tribonacci sequence of 'n' size started with 'signature' elements
+         * @brief Lazy range of all distinct permutations of a sequence in lexicographical order.
+         * Each iterator owns a single buffer that is mutated in place with "std::next_permutation()",
+         * so only one permutation is kept in memory at a time. Permutations are numbered by rank
+         * [0; size()), any of them can be reached directly with 'unrank()' and the ranks can be
+         * split into independent subranges (see 'split()' and 'parallelForEach()').
+         * If there are more than 2^64 - 1 permutations, only the first 2^64 - 1 are addressable.
+         * @tparam Seq sequence type (e.g. "std::string", "std::vector<int>")
+         *
+         * Example of usage:
+         * for (std::string const &perm : permutations_view<>("abcd"))
+         *     std::cout << perm << '\n';
          */
-        std::vector<int> tribonacci(std::vector<int> signature, int n);
+        template <typename Seq = std::string>
+        class permutations_view
+        {
+        private:
+            Seq m_sorted;                      // Lexicographically first permutation
+            std::uint64_t m_first{}, m_last{}; // Ranks of the permutations: [m_first; m_last)
 
-        /**
-         * @brief Calculates sum of two polynomials, assumes that coefficients in both args (polynomials)
-         * are in correct order (for example, A(x) = 5x^3 + 2x^2 - 7x + 3) -> where 5 is the last index, 3 is the first.
-         * @tparam a - first polynomial.
-         * @tparam b - second polynomial.
-         * @return C(x) - resulting polynomial in correct order (see above).
-         */
-        template <std::integral T>
-        constexpr std::vector<T> sumOfPolynomials(std::span<T const> a, std::span<T const> b);
+            permutations_view(Seq const &sorted, std::uint64_t first, std::uint64_t last)
+                : m_sorted(sorted), m_first(first), m_last(last) {}
 
-        /**
-         * @brief Calculates sum of the matrices.
-         * @tparam a - 1st matrix.
-         * @tparam b - 2nd matrix.
-         * @return Matrix where all elements are summarized (a + b).
-         */
-        template <std::integral T>
-        std::vector<std::vector<T>> sumOfTheMatrices(Matrix<T> auto const &a, Matrix<T> auto const &b);
+            /// @brief Saturating multiplication: returns 2^64 - 1 on overflow
+            static constexpr std::uint64_t mulSat(std::uint64_t a, std::uint64_t b) noexcept
+            {
+                std::uint64_t res{};
+                return __builtin_mul_overflow(a, b, &res) ? std::numeric_limits<std::uint64_t>::max() : res;
+            }
 
-        /**
-         * @brief Transposes matrix
-         * @tparam T restictions: constructible, copy/move-assignable
-         * @tparam matrix matrix to transpose
-         * @return Transposed matrix as vector of vectors
-         */
-        template <typename T>
-        std::vector<std::vector<T>> transposeMatrix(Matrix<T> auto const &matrix);
+            /**
+             * @brief Counts distinct permutations of the sorted range (multinomial coefficient).
+             * Saturates to 2^64 - 1 when the count doesn't fit into 64 bits.
+             */
+            template <typename Iter>
+            static std::uint64_t countSorted(Iter first, Iter last) noexcept
+            {
+                std::uint64_t count{1ull}, total{};
+                while (first != last)
+                {
+                    // Length of the run of equal elements
+                    auto next{std::find_if(first, last, [&first](auto const &el)
+                                           { return el != *first; })};
+                    std::uint64_t const run{static_cast<std::uint64_t>(std::distance(first, next))};
+
+                    // count *= C(total + run, run), computed incrementally to stay exact
+                    std::uint64_t binom{1ull};
+                    for (std::uint64_t i{1ull}; i <= run; i++)
+                    {
+                        std::uint64_t const mul{mulSat(binom, total + i)};
+                        binom = (mul == std::numeric_limits<std::uint64_t>::max()) ? mul : mul / i;
+                    }
+                    count = mulSat(count, binom);
+                    total += run;
+                    first = next;
+                }
+                return count;
+            }
 
-        /**
-         * @brief Searches common prefix in sequence of strings.
-         * @tparam strings sequence of strings
-         * @return Common prefix in all passed strings
-         */
-        template <StringConvertible T>
-        std::string commonPrefix(std::span<T const> strings);
+        public:
+            /**
+             * @brief Lazy permutation iterator. Holds the current permutation by value and
+             * rearranges it in place on every increment.
+             */
+            class iterator
+            {
+            private:
+                Seq m_buf;
+                std::uint64_t m_remaining{};
 
-        /**
-         * @brief Finds common letters in a sequence of words
-         * @param words sequence of words
-         * @return Common letters as a word ("std::string" instance)
-         */
-        std::string commonLetters(std::vector<std::string> const &words);
+            public:
+                using value_type = Seq;
+                using difference_type = std::ptrdiff_t;
 
-        /**
-         * @brief Joins passed strings with passed delimiter.
-         * @param tokens strings to be combined.
-         * @param delim delimiter by which they would joining.
-         * @return String composed from passed range of strings with specified delimiter.
-         */
-        std::string join(std::span<std::string_view> tokens, std::string_view delim);
+                iterator() = default;
+                iterator(Seq buf, std::uint64_t remaining) : m_buf(std::move(buf)), m_remaining(remaining) {}
 
-        /**
-         * @brief Gets all non-empty dirs and subdirs
-         * @param dirs path to directories
-         * @return Set of non-empty directories in lexicographical order
-         *
-         * Example of usage:
-         * std::vector<std::string> dirs;
-         * std::string path;
-         * while (std::getline(std::cin, path))
-         *     dirs.emplace_back(path);
-         * for (std::string_view dir : extractNonEmptyDirs(dirs))
-         *     std::cout << dir << '\n';
-         */
-        std::vector<std::string> extractNonEmptyDirs(std::vector<std::string> dirs);
+                Seq const &operator*() const noexcept { return m_buf; }
+                Seq const *operator->() const noexcept { return std::addressof(m_buf); }
 
-        /**
-         * @brief Calculate the frequencies of symbolic n-grams in a text
-         * @param words list of words
-         * @param lengthOfNGramm length of each n-gram
-         * @return Vector of words and their frequencies correspondingly.
-         * Vector sorted by frequencies if freqs are equal - lexicograpically sorted
-         */
-        std::vector<std::pair<std::string, int>> calculateNGramFrequencies(std::vector<std::string> const &words,
-                                                                           size_t lengthOfNGramm);
+                iterator &operator++()
+                {
+                    // Do not rearrange buffer after the last permutation of the range
+                    if (--m_remaining != 0ull && !std::next_permutation(std::begin(m_buf), std::end(m_buf)))
+                        m_remaining = 0ull;
+                    return *this;
+                }
+                void operator++(int) { ++*this; }
 
-        /**
-         * @brief Duplicates vector elements to itself
-         * @tparam v vector to duplicate
-         */
-        template <typename T>
-        void duplicateVector(std::vector<T> &v);
+                bool operator==(std::default_sentinel_t) const noexcept { return m_remaining == 0ull; }
+            };
 
-        /**
+            /**
+             * @brief Constructs range of all permutations of the sequence
+             * @param seq sequence to permute. Doesn't need to be sorted
+             */
+            explicit permutations_view(Seq seq) : m_sorted(std::move(seq))
+            {
+                std::sort(std::begin(m_sorted), std::end(m_sorted));
+                m_last = countSorted(std::cbegin(m_sorted), std::cend(m_sorted));
+            }
+
+            /// @brief Count of permutations in the range
+            std::uint64_t size() const noexcept { return m_last - m_first; }
+            bool empty() const noexcept { return m_first == m_last; }
+
+            iterator begin() const { return iterator(unrank(m_first), size()); }
+            std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+
+            /**
+             * @brief Writes permutation with rank 'k' to the 'out' without any allocations if
+             * 'out' already has the necessary capacity
+             * @param k rank of the permutation (in whole set of permutations, not in subrange)
+             * @param out buffer for the result
+             */
+            void unrank(std::uint64_t k, Seq &out) const
+            {
+                out = m_sorted;
+                auto const first{std::begin(out)}, last{std::end(out)};
+
+                // Suffix [pos; last) always stays sorted, so we select a value for the 'pos'
+                // by moving candidates to the front of the suffix one by one
+                for (auto pos{first}; pos != last; ++pos)
+                {
+                    for (auto cand{pos}; cand != last;)
+                    {
+                        std::rotate(pos, cand, std::next(cand));
+                        std::uint64_t const count{countSorted(std::next(pos), last)};
+                        if (k < count)
+                            break;
+
+                        // Putting candidate back and moving to the next distinct value
+                        k -= count;
+                        std::rotate(pos, std::next(pos), std::next(cand));
+                        cand = std::upper_bound(cand, last, *cand);
+                    }
+                }
+            }
+
+            /**
+             * @brief Returns permutation with rank 'k'
+             * @param k rank of the permutation (in whole set of permutations, not in subrange)
+             * @return Permutation with rank 'k'
+             */
+            Seq unrank(std::uint64_t k) const
+            {
+                Seq out;
+                unrank(k, out);
+                return out;
+            }
+
+            /**
+             * @brief Returns subrange of the permutations
+             * @param first rank of the first permutation relative to the current range
+             * @param last rank of the one-past-last permutation relative to the current range
+             */
+            permutations_view subrange(std::uint64_t first, std::uint64_t last) const
+            {
+                if (first > last || last > size())
+                    throw std::out_of_range("permutations_view::subrange(): ranks are out of range");
+                return permutations_view(m_sorted, m_first + first, m_first + last);
+            }
+
+            /**
+             * @brief Splits range on 'parts' subranges of (almost) equal size
+             * @param parts count of subranges
+             * @return Vector of non-empty subranges, that are covering whole range
+             */
+            std::vector<permutations_view> split(std::uint64_t parts) const
+            {
+                std::vector<permutations_view> views;
+                parts = std::clamp(parts, std::uint64_t{1ull}, std::max(size(), std::uint64_t{1ull}));
+                views.reserve(parts);
+
+                std::uint64_t const chunk{size() / parts}, rest{size() % parts};
+                for (std::uint64_t i{}, first{}; i < parts; i++)
+                {
+                    std::uint64_t const last{first + chunk + (i < rest ? 1ull : 0ull)};
+                    views.emplace_back(subrange(first, last));
+                    first = last;
+                }
+                return views;
+            }
+        };
+
+        /**
+         * @brief Lazy range of all combinations of 'k' elements from a sequence.
+         * Elements are taken by their positions, so equal elements are treated as different ones.
+         * Combinations are generated in lexicographical order of positions, each iterator
+         * keeps one index array and one buffer of 'k' elements which are updated in place.
+         * Supports unranking and splitting just like 'permutations_view'.
+         * @tparam Seq sequence type (e.g. "std::string", "std::vector<int>")
+         *
+         * Example of usage:
+         * for (std::string const &comb : combinations_view<>("abcd", 2))
+         *     std::cout << comb << '\n'; // ab ac ad bc bd cd
+         */
+        template <typename Seq = std::string>
+        class combinations_view
+        {
+        private:
+            Seq m_seq;
+            size_t m_k{};
+            std::uint64_t m_first{}, m_last{}; // Ranks of the combinations: [m_first; m_last)
+
+            combinations_view(Seq const &seq, size_t k, std::uint64_t first, std::uint64_t last)
+                : m_seq(seq), m_k(k), m_first(first), m_last(last) {}
+
+            /// @brief Binomial coefficient C(n, k), saturates to 2^64 - 1 on overflow
+            static std::uint64_t binomial(std::uint64_t n, std::uint64_t k) noexcept
+            {
+                if (k > n)
+                    return 0ull;
+                k = std::min(k, n - k);
+
+                std::uint64_t res{1ull};
+                for (std::uint64_t i{1ull}; i <= k; i++)
+                {
+                    // res * (n - k + i) is always divisible by 'i'
+                    std::uint64_t mul{};
+                    if (__builtin_mul_overflow(res, n - k + i, &mul))
+                        return std::numeric_limits<std::uint64_t>::max();
+                    res = mul / i;
+                }
+                return res;
+            }
+
+        public:
+            /**
+             * @brief Lazy combination iterator. Holds the positions and elements of the current
+             * combination and rewrites only changed tail on every increment.
+             */
+            class iterator
+            {
+            private:
+                Seq const *m_seq{nullptr};
+                std::vector<size_t> m_idx;
+                Seq m_buf;
+                std::uint64_t m_remaining{};
+
+            public:
+                using value_type = Seq;
+                using difference_type = std::ptrdiff_t;
+
+                iterator() = default;
+                iterator(Seq const &seq, std::vector<size_t> idx, Seq buf, std::uint64_t remaining)
+                    : m_seq(std::addressof(seq)), m_idx(std::move(idx)), m_buf(std::move(buf)), m_remaining(remaining) {}
+
+                Seq const &operator*() const noexcept { return m_buf; }
+                Seq const *operator->() const noexcept { return std::addressof(m_buf); }
+
+                iterator &operator++()
+                {
+                    if (--m_remaining == 0ull)
+                        return *this;
+
+                    size_t const n{std::size(*m_seq)}, k{m_idx.size()};
+
+                    // Searching the rightmost position that can be incremented
+                    size_t i{k};
+                    while (i > 0ul && m_idx[i - 1ul] == n - k + i - 1ul)
+                        --i;
+                    if (i == 0ul)
+                    {
+                        m_remaining = 0ull;
+                        return *this;
+                    }
+
+                    // Incrementing it and resetting all positions after it
+                    ++m_idx[i - 1ul];
+                    for (size_t j{i - 1ul}; j < k; j++)
+                    {
+                        if (j >= i)
+                            m_idx[j] = m_idx[j - 1ul] + 1ul;
+                        m_buf[j] = (*m_seq)[m_idx[j]];
+                    }
+                    return *this;
+                }
+                void operator++(int) { ++*this; }
+
+                bool operator==(std::default_sentinel_t) const noexcept { return m_remaining == 0ull; }
+            };
+
+            /**
+             * @brief Constructs range of all combinations of 'k' elements of the sequence
+             * @param seq sequence to choose elements from
+             * @param k count of elements in each combination
+             */
+            combinations_view(Seq seq, size_t k) : m_seq(std::move(seq)), m_k(k)
+            {
+                m_last = binomial(std::size(m_seq), m_k);
+            }
+
+            /// @brief Count of combinations in the range
+            std::uint64_t size() const noexcept { return m_last - m_first; }
+            bool empty() const noexcept { return m_first == m_last; }
+
+            /// @note Iterators refer to the sequence stored in the view, so view must outlive them
+            iterator begin() const
+            {
+                if (empty())
+                    return iterator();
+
+                std::vector<size_t> idx(unrankIndices(m_first));
+                Seq buf(m_seq);
+                buf.resize(m_k);
+                for (size_t i{}; i < m_k; i++)
+                    buf[i] = m_seq[idx[i]];
+                return iterator(m_seq, std::move(idx), std::move(buf), size());
+            }
+            std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+
+            /**
+             * @brief Returns positions of elements in combination with rank 'r'
+             * @param r rank of the combination (in whole set of combinations, not in subrange)
+             * @return Positions of elements of the combination in ascending order
+             */
+            std::vector<size_t> unrankIndices(std::uint64_t r) const
+            {
+                std::vector<size_t> idx(m_k);
+                size_t const n{std::size(m_seq)};
+
+                // Choosing the smallest possible position for every element of the combination
+                for (size_t i{}, pos{}; i < m_k; i++, pos++)
+                {
+                    for (std::uint64_t count{binomial(n - pos - 1ul, m_k - i - 1ul)};
+                         r >= count; count = binomial(n - pos - 1ul, m_k - i - 1ul))
+                    {
+                        r -= count;
+                        ++pos;
+                    }
+                    idx[i] = pos;
+                }
+                return idx;
+            }
+
+            /**
+             * @brief Returns combination with rank 'r'
+             * @param r rank of the combination (in whole set of combinations, not in subrange)
+             * @return Combination with rank 'r'
+             */
+            Seq unrank(std::uint64_t r) const
+            {
+                Seq out(m_seq);
+                out.resize(m_k);
+                size_t i{};
+                for (size_t pos : unrankIndices(r))
+                    out[i++] = m_seq[pos];
+                return out;
+            }
+
+            /**
+             * @brief Returns subrange of the combinations
+             * @param first rank of the first combination relative to the current range
+             * @param last rank of the one-past-last combination relative to the current range
+             */
+            combinations_view subrange(std::uint64_t first, std::uint64_t last) const
+            {
+                if (first > last || last > size())
+                    throw std::out_of_range("combinations_view::subrange(): ranks are out of range");
+                return combinations_view(m_seq, m_k, m_first + first, m_first + last);
+            }
+
+            /**
+             * @brief Splits range on 'parts' subranges of (almost) equal size
+             * @param parts count of subranges
+             * @return Vector of non-empty subranges, that are covering whole range
+             */
+            std::vector<combinations_view> split(std::uint64_t parts) const
+            {
+                std::vector<combinations_view> views;
+                parts = std::clamp(parts, std::uint64_t{1ull}, std::max(size(), std::uint64_t{1ull}));
+                views.reserve(parts);
+
+                std::uint64_t const chunk{size() / parts}, rest{size() % parts};
+                for (std::uint64_t i{}, first{}; i < parts; i++)
+                {
+                    std::uint64_t const last{first + chunk + (i < rest ? 1ull : 0ull)};
+                    views.emplace_back(subrange(first, last));
+                    first = last;
+                }
+                return views;
+            }
+        };
+
+        /**
+         * @brief Calls 'fn' for every element of splittable range ('permutations_view' or
+         * 'combinations_view') splitting the ranks between 'threads' threads.
+         * Order of the calls is unspecified, 'fn' must be safe to call concurrently.
+         * @param view range to iterate over
+         * @param fn callable that takes element of the range
+         * @param threads count of threads, by default - count of hardware threads
+         * @throw the first exception thrown by 'fn', other threads stop at their next element
+         */
+        template <typename View, typename Fn>
+        void parallelForEach(View const &view, Fn fn, unsigned threads = std::thread::hardware_concurrency())
+        {
+            auto const parts{view.split(std::max(threads, 1u))};
+
+            std::mutex errorMutex;
+            std::exception_ptr error;
+            std::atomic<bool> stop{false};
+            {
+                // Every thread iterates over its own subrange with its own buffer
+                std::vector<std::jthread> workers;
+                workers.reserve(parts.size());
+                for (auto const &part : parts)
+                    workers.emplace_back([&part, &fn, &errorMutex, &error, &stop]()
+                                         {
+                                             try
+                                             {
+                                                 for (auto const &el : part)
+                                                 {
+                                                     if (stop.load(std::memory_order_relaxed))
+                                                         return;
+                                                     fn(el);
+                                                 }
+                                             }
+                                             catch (...)
+                                             {
+                                                 std::lock_guard lock(errorMutex);
+                                                 if (!error)
+                                                     error = std::current_exception();
+                                                 stop.store(true, std::memory_order_relaxed);
+                                             } });
+            }
+            if (error)
+                std::rethrow_exception(error);
+        }
+
+        /**
+         * @brief Calculates 'n' elements from Tribonacci sequence by passes sequence
+         * @param signature sequence of integer elements
+         * @param n count of elements in the result sequence
+         * @return Tribonacci sequence of 'n' size started with 'signature' elements
+         */
+        std::vector<int> tribonacci(std::vector<int> signature, int n);
+
+        /**
+         * @brief Integer modulo 'Mod' with 128-bit intermediate products, so any 'Mod' < 2^64 is allowed.
+         * Can be used as an element type of 'LinearRecurrence' to calculate terms modulo 'Mod'.
+         * @tparam Mod modulus
+         */
+        template <std::uint64_t Mod>
+        class ModInt
+        {
+            static_assert(Mod > 1ull, "Modulus must be greater than 1");
+
+        private:
+            std::uint64_t m_value{};
+
+        public:
+            constexpr ModInt() = default;
+
+            template <std::integral I>
+            constexpr ModInt(I value) noexcept
+            {
+                if constexpr (std::is_signed_v<I>)
+                {
+                    int128_t const rem{static_cast<int128_t>(value) % static_cast<int128_t>(Mod)};
+                    m_value = static_cast<std::uint64_t>(rem < 0 ? rem + Mod : rem);
+                }
+                else
+                    m_value = static_cast<std::uint64_t>(static_cast<uint128_t>(value) % Mod);
+            }
+
+            /// @brief Returns value in range [0; Mod)
+            constexpr std::uint64_t value() const noexcept { return m_value; }
+
+            constexpr ModInt &operator+=(ModInt other) noexcept
+            {
+                m_value = (m_value >= Mod - other.m_value) ? m_value - (Mod - other.m_value) : m_value + other.m_value;
+                return *this;
+            }
+            constexpr ModInt &operator-=(ModInt other) noexcept
+            {
+                m_value = (m_value >= other.m_value) ? m_value - other.m_value : m_value + (Mod - other.m_value);
+                return *this;
+            }
+            constexpr ModInt &operator*=(ModInt other) noexcept
+            {
+                // Product of values less than 2^32 fits into 64 bits, so division by constant stays cheap
+                if constexpr (Mod <= 0xFFFF'FFFFull)
+                    m_value = m_value * other.m_value % Mod;
+                else
+                    m_value = static_cast<std::uint64_t>(static_cast<uint128_t>(m_value) * other.m_value % Mod);
+                return *this;
+            }
+
+            /// @brief Binary exponentiation: returns this^e
+            constexpr ModInt pow(std::uint64_t e) const noexcept
+            {
+                ModInt res(1), base(*this);
+                for (; e != 0ull; e >>= 1ull, base *= base)
+                    if (e & 1ull)
+                        res *= base;
+                return res;
+            }
+
+            /// @brief Multiplicative inverse by Fermat's little theorem, 'Mod' must be prime
+            constexpr ModInt inv() const noexcept { return pow(Mod - 2ull); }
+
+            friend constexpr ModInt operator+(ModInt a, ModInt b) noexcept { return a += b; }
+            friend constexpr ModInt operator-(ModInt a, ModInt b) noexcept { return a -= b; }
+            friend constexpr ModInt operator*(ModInt a, ModInt b) noexcept { return a *= b; }
+            friend constexpr bool operator==(ModInt a, ModInt b) noexcept { return a.m_value == b.m_value; }
+            friend std::ostream &operator<<(std::ostream &os, ModInt a) { return os << a.m_value; }
+        };
+
+        /**
+         * @brief Homogeneous linear recurrence of order 'k' with constant coefficients:
+         * a(n) = c[0] * a(n - 1) + c[1] * a(n - 2) + ... + c[k - 1] * a(n - k).
+         * Calculates n-th term with exponentiation of companion matrix for O(k^3 * log(n))
+         * and bulk sequences in O(n * k) into preallocated memory.
+         * @tparam T arithmetic type of the terms: any integral or floating type, 'uint128_t',
+         * 'ModInt<Mod>' for terms modulo 'Mod' or any other type with '+', '*' and construction from 0 and 1
+         *
+         * Example of usage:
+         * LinearRecurrence<ModInt<1'000'000'007>> trib({1, 1, 1}, {0, 0, 1});
+         * auto term{trib.nth(1'000'000'000'000'000'000ull)};
+         */
+        template <typename T>
+        class LinearRecurrence
+        {
+        private:
+            std::vector<T> m_coefs, m_initial;
+
+            /// @brief Product of the two square matrices 'k' x 'k' stored in row-major order
+            std::vector<T> mul(std::vector<T> const &a, std::vector<T> const &b) const
+            {
+                size_t const k{order()};
+                std::vector<T> res(k * k, T(0));
+                for (size_t i{}; i < k; i++)
+                    for (size_t l{}; l < k; l++)
+                    {
+                        T const a_il{a[i * k + l]};
+                        for (size_t j{}; j < k; j++)
+                            res[i * k + j] = res[i * k + j] + a_il * b[l * k + j];
+                    }
+                return res;
+            }
+
+        public:
+            /**
+             * @brief Constructs recurrence of order 'coefs.size()'
+             * @param coefs coefficients: a(n) = coefs[0] * a(n - 1) + ... + coefs[k - 1] * a(n - k)
+             * @param initial first 'k' terms: a(0), a(1), ..., a(k - 1)
+             */
+            LinearRecurrence(std::vector<T> coefs, std::vector<T> initial)
+                : m_coefs(std::move(coefs)), m_initial(std::move(initial))
+            {
+                if (m_coefs.empty() || m_coefs.size() != m_initial.size())
+                    throw std::invalid_argument("LinearRecurrence: count of coefficients and initial terms must be equal and non-zero");
+            }
+
+            /// @brief Returns order of the recurrence ('k')
+            size_t order() const noexcept { return m_coefs.size(); }
+
+            /**
+             * @brief Calculates n-th term of the sequence, O(k^3 * log(n))
+             * @param n index of the term (starting from 0)
+             * @return Term a(n)
+             */
+            T nth(std::uint64_t n) const
+            {
+                size_t const k{order()};
+                if (n < k)
+                    return m_initial[n];
+
+                // Companion matrix: maps (a(i + k - 1), ..., a(i)) to (a(i + k), ..., a(i + 1))
+                std::vector<T> base(k * k, T(0)), power(k * k, T(0));
+                for (size_t j{}; j < k; j++)
+                    base[j] = m_coefs[j];
+                for (size_t i{1ul}; i < k; i++)
+                    base[i * k + i - 1ul] = T(1);
+                for (size_t i{}; i < k; i++)
+                    power[i * k + i] = T(1);
+
+                // Binary exponentiation: power = base^(n - k + 1)
+                for (std::uint64_t e{n - k + 1ull}; e != 0ull; e >>= 1ull)
+                {
+                    if (e & 1ull)
+                        power = mul(power, base);
+                    if (e > 1ull)
+                        base = mul(base, base);
+                }
+
+                // First row applied to the state vector (a(k - 1), ..., a(0)) gives a(n)
+                T res(0);
+                for (size_t j{}; j < k; j++)
+                    res = res + power[j] * m_initial[k - 1ul - j];
+                return res;
+            }
+
+            /**
+             * @brief Fills preallocated memory with first 'out.size()' terms of the sequence, O(n * k)
+             * @param out destination for terms a(0), a(1), ..., a(out.size() - 1)
+             */
+            void generate(std::span<T> out) const
+            {
+                size_t const k{order()}, head{std::min(k, out.size())};
+                std::copy_n(m_initial.cbegin(), head, out.begin());
+
+                for (size_t i{k}; i < out.size(); i++)
+                {
+                    T term(0);
+                    for (size_t j{}; j < k; j++)
+                        term = term + m_coefs[j] * out[i - 1ul - j];
+                    out[i] = term;
+                }
+            }
+
+            /**
+             * @brief Returns first 'count' terms of the sequence, O(n * k)
+             * @param count count of terms
+             * @return Vector of terms a(0), a(1), ..., a(count - 1)
+             */
+            std::vector<T> generate(size_t count) const
+            {
+                std::vector<T> out(count, T(0));
+                generate(std::span<T>(out));
+                return out;
+            }
+        };
+
+        /**
+         * @brief Calculates n-th term of k-bonacci sequence: k - 1 zeros, 1, and then
+         * every term is a sum of 'k' previous ones (k = 2 - Fibonacci, k = 3 - Tribonacci, ...)
+         * @tparam T arithmetic type of the terms (see 'LinearRecurrence')
+         * @param k order of the sequence
+         * @param n index of the term (starting from 0)
+         * @return n-th term of the k-bonacci sequence
+         */
+        template <typename T = std::uint64_t>
+        T kbonacci(size_t k, std::uint64_t n)
+        {
+            std::vector<T> initial(k, T(0));
+            if (k != 0ul)
+                initial.back() = T(1);
+            return LinearRecurrence<T>(std::vector<T>(k, T(1)), std::move(initial)).nth(n);
+        }
+
+        /**
+         * @brief Calculates sum of two polynomials, assumes that coefficients in both args (polynomials)
+         * are in correct order (for example, A(x) = 5x^3 + 2x^2 - 7x + 3) -> where 5 is the last index, 3 is the first.
+         * @tparam a - first polynomial.
+         * @tparam b - second polynomial.
+         * @return C(x) - resulting polynomial in correct order (see above).
+         */
+        template <std::integral T>
+        constexpr std::vector<T> sumOfPolynomials(std::span<T const> a, std::span<T const> b);
+
+        /**
+         * Polynomials are represented by their coefficients in the same order as in 'sumOfPolynomials()':
+         * from the highest degree to the lowest, e.g. A(x) = 5x^3 + 2x^2 - 7x + 3 -> {5, 2, -7, 3}.
+         * Integer arithmetic wraps around modulo 2^N like unsigned one.
+         */
+        namespace polynomial
+        {
+            /**
+             * @brief Adds two polynomials without any allocations: coefficients are aligned to the right
+             * (by the lowest degree), so no reversing is needed
+             * @param a first polynomial
+             * @param b second polynomial
+             * @param out destination of size max(a.size(), b.size()), may be the same memory as 'a' or 'b'
+             */
+            template <typename T>
+            constexpr void add(std::span<std::type_identity_t<T> const> a, std::span<std::type_identity_t<T> const> b,
+                               std::span<T> out)
+            {
+                if (out.size() != std::max(a.size(), b.size()))
+                    throw std::invalid_argument("polynomial::add(): size of the destination doesn't match");
+
+                // Index 'i' is counted from the end, i.e. it is a degree of the term
+                for (size_t i{1ul}; i <= out.size(); i++)
+                {
+                    T const lhs{(i <= a.size()) ? a[a.size() - i] : T(0)}, rhs{(i <= b.size()) ? b[b.size() - i] : T(0)};
+                    out[out.size() - i] = lhs + rhs;
+                }
+            }
+
+            /// @brief Integer type for calculations with wrapping around for integers
+            template <typename T>
+            using wrapping_t = typename std::conditional_t<std::is_integral_v<T> && !std::is_same_v<T, bool>,
+                                                           std::make_unsigned<T>, std::type_identity<T>>::type;
+
+            /**
+             * @brief Schoolbook multiplication O(n * m), the fastest for short polynomials
+             * @param a first polynomial
+             * @param b second polynomial
+             * @param out destination of size a.size() + b.size() - 1, mustn't overlap with 'a' and 'b'
+             */
+            template <typename T>
+            void multiplySchoolbook(std::span<std::type_identity_t<T> const> a, std::span<std::type_identity_t<T> const> b,
+                                    std::span<T> out)
+            {
+                using W = wrapping_t<T>;
+                std::ranges::fill(out, T(0));
+                for (size_t i{}; i < a.size(); i++)
+                {
+                    W const ai{static_cast<W>(a[i])};
+                    for (size_t j{}; j < b.size(); j++)
+                        out[i + j] = static_cast<T>(static_cast<W>(out[i + j]) + ai * static_cast<W>(b[j]));
+                }
+            }
+
+            /**
+             * @brief Auxiliary method for Karatsuba multiplication of the polynomials of the same size 'n'
+             * @param a first polynomial
+             * @param b second polynomial
+             * @param n size of the both polynomials
+             * @param res destination of size 2n - 1
+             * @param scratch temporary memory of size at least 8n
+             */
+            template <typename W>
+            void karatsubaHelper(W const *a, W const *b, size_t n, W *res, W *scratch)
+            {
+                constexpr size_t kThreshold{32ul};
+                if (n <= kThreshold)
+                {
+                    std::fill_n(res, 2ul * n - 1ul, W(0));
+                    for (size_t i{}; i < n; i++)
+                        for (size_t j{}; j < n; j++)
+                            res[i + j] += a[i] * b[j];
+                    return;
+                }
+
+                // a = a0 + a1 * x^h, b = b0 + b1 * x^h (with 'm' >= 'h')
+                size_t const h{n / 2ul}, m{n - h};
+                W *const asum{scratch}, *const bsum{scratch + m}, *const mid{scratch + 2ul * m};
+
+                // z0 = a0 * b0 -> res[0; 2h - 1), z2 = a1 * b1 -> res[2h; 2n - 1)
+                karatsubaHelper(a, b, h, res, scratch + 4ul * m);
+                res[2ul * h - 1ul] = W(0);
+                karatsubaHelper(a + h, b + h, m, res + 2ul * h, scratch + 4ul * m);
+
+                // z1 = (a0 + a1)(b0 + b1) - z0 - z2
+                for (size_t i{}; i < m; i++)
+                {
+                    asum[i] = a[h + i] + ((i < h) ? a[i] : W(0));
+                    bsum[i] = b[h + i] + ((i < h) ? b[i] : W(0));
+                }
+                karatsubaHelper(asum, bsum, m, mid, scratch + 4ul * m);
+                for (size_t i{}; i < 2ul * h - 1ul; i++)
+                    mid[i] -= res[i];
+                for (size_t i{}; i < 2ul * m - 1ul; i++)
+                    mid[i] -= res[2ul * h + i];
+
+                for (size_t i{}; i < 2ul * m - 1ul; i++)
+                    res[h + i] += mid[i];
+            }
+
+            /**
+             * @brief Karatsuba multiplication O(n^1.58). Unbalanced polynomials are multiplied by chunks
+             * of the shorter polynomial size.
+             * @param a first polynomial
+             * @param b second polynomial
+             * @param out destination of size a.size() + b.size() - 1, mustn't overlap with 'a' and 'b'
+             */
+            template <typename T>
+            void multiplyKaratsuba(std::span<std::type_identity_t<T> const> a, std::span<std::type_identity_t<T> const> b,
+                                   std::span<T> out)
+            {
+                using W = wrapping_t<T>;
+                if (a.size() < b.size())
+                    std::swap(a, b);
+                std::ranges::fill(out, T(0));
+                if (b.empty())
+                    return;
+
+                size_t const n{b.size()};
+                std::vector<W> chunk(n), wb(b.begin(), b.end()), prod(2ul * n - 1ul), scratch(8ul * n);
+                for (size_t pos{}; pos < a.size(); pos += n)
+                {
+                    // The last chunk is padded with zeros
+                    size_t const len{std::min(n, a.size() - pos)};
+                    std::fill(std::copy_n(a.begin() + pos, len, chunk.begin()), chunk.end(), W(0));
+
+                    karatsubaHelper(chunk.data(), wb.data(), n, prod.data(), scratch.data());
+                    for (size_t i{}; i < len + n - 1ul; i++)
+                        out[pos + i] = static_cast<T>(static_cast<W>(out[pos + i]) + prod[i]);
+                }
+            }
+
+            /**
+             * @brief In-place iterative number-theoretic transform (FFT over the field of residues modulo 'Mod')
+             * @tparam Mod prime modulus of the form c * 2^k + 1
+             * @tparam Root primitive root modulo 'Mod'
+             * @param a sequence of the size that is a power of 2 and divides 'Mod' - 1
+             * @param invert "true" for the inverse transform
+             */
+            template <std::uint64_t Mod, std::uint64_t Root>
+            void ntt(std::span<ModInt<Mod>> a, bool invert)
+            {
+                size_t const n{a.size()};
+
+                // Bit-reversal permutation
+                for (size_t i{1ul}, j{}; i < n; i++)
+                {
+                    size_t bit{n >> 1ul};
+                    for (; j & bit; bit >>= 1ul)
+                        j ^= bit;
+                    j ^= bit;
+                    if (i < j)
+                        std::swap(a[i], a[j]);
+                }
+
+                std::vector<ModInt<Mod>> roots(n / 2ul + 1ul);
+                for (size_t len{2ul}; len <= n; len <<= 1ul)
+                {
+                    // Powers of the root of unity of degree 'len' are computed once per stage
+                    ModInt<Mod> wlen{ModInt<Mod>(Root).pow((Mod - 1ull) / len)};
+                    if (invert)
+                        wlen = wlen.inv();
+                    roots[0] = ModInt<Mod>(1);
+                    for (size_t k{1ul}; k < len / 2ul; k++)
+                        roots[k] = roots[k - 1ul] * wlen;
+
+                    for (size_t i{}; i < n; i += len)
+                        for (size_t k{}; k < len / 2ul; k++)
+                        {
+                            ModInt<Mod> const u{a[i + k]}, v{a[i + k + len / 2ul] * roots[k]};
+                            a[i + k] = u + v;
+                            a[i + k + len / 2ul] = u - v;
+                        }
+                }
+
+                if (invert)
+                {
+                    ModInt<Mod> const nInv{ModInt<Mod>(n).inv()};
+                    for (auto &el : a)
+                        el *= nInv;
+                }
+            }
+
+            /**
+             * @brief Auxiliary method for NTT multiplication: product of the polynomials modulo 'Mod'
+             * @return Coefficients of the product modulo 'Mod'
+             */
+            template <std::uint64_t Mod, std::uint64_t Root, typename T>
+            std::vector<ModInt<Mod>> nttProduct(std::span<T const> a, std::span<T const> b, size_t n)
+            {
+                std::vector<ModInt<Mod>> fa(n);
+                std::ranges::transform(a, fa.begin(), [](T v)
+                                       { return ModInt<Mod>(v); });
+                ntt<Mod, Root>(fa, false);
+
+                // Squaring needs only one forward transform
+                if (a.data() == b.data() && a.size() == b.size())
+                    for (auto &el : fa)
+                        el *= el;
+                else
+                {
+                    std::vector<ModInt<Mod>> fb(n);
+                    std::ranges::transform(b, fb.begin(), [](T v)
+                                           { return ModInt<Mod>(v); });
+                    ntt<Mod, Root>(fb, false);
+                    for (size_t i{}; i < n; i++)
+                        fa[i] *= fb[i];
+                }
+                ntt<Mod, Root>(fa, true);
+                return fa;
+            }
+
+            /// @brief NTT-friendly primes of the form c * 2^k + 1 with primitive root 3, transforms up to 2^23 points
+            inline constexpr std::uint64_t kNttPrimes[]{998'244'353ull, 167'772'161ull, 469'762'049ull};
+
+            /// @brief Maximal length of the transform supported by all of the 'kNttPrimes'
+            inline constexpr size_t kNttMaxLength{1ul << 23ul};
+
+            /**
+             * @brief Garner's algorithm: restores number x < p1 * p2 * p3 from its residues modulo 'kNttPrimes'
+             * @return x = x1 + p1 * (x2 + p2 * x3)
+             */
+            inline uint128_t crt3(ModInt<kNttPrimes[0]> r1, ModInt<kNttPrimes[1]> r2, ModInt<kNttPrimes[2]> r3)
+            {
+                constexpr std::uint64_t p1{kNttPrimes[0]}, p2{kNttPrimes[1]}, p3{kNttPrimes[2]};
+                constexpr uint128_t p12{static_cast<uint128_t>(p1) * p2};
+                static ModInt<p2> const inv1{ModInt<p2>(p1).inv()};
+                static ModInt<p3> const inv12{ModInt<p3>(static_cast<std::uint64_t>(p12 % p3)).inv()};
+
+                std::uint64_t const x1{r1.value()}, x2{((r2 - ModInt<p2>(x1)) * inv1).value()};
+                uint128_t const x12{x1 + static_cast<uint128_t>(p1) * x2};
+                std::uint64_t const x3{((r3 - ModInt<p3>(static_cast<std::uint64_t>(x12 % p3))) * inv12).value()};
+                return x12 + p12 * x3;
+            }
+
+            /**
+             * @brief Checks that 'multiplyNTT()' restores every coefficient of the product exactly:
+             * max|a| * max|b| * min(a.size(), b.size()) must be less than p1 * p2 * p3 / 2
+             */
+            template <std::integral T>
+            bool isNttExact(std::span<T const> a, std::span<T const> b) noexcept
+            {
+                auto const maxMagnitude{[](std::span<T const> p)
+                                        {
+                                            std::uint64_t max{};
+                                            for (T const el : p)
+                                            {
+                                                auto const u{static_cast<std::uint64_t>(el)};
+                                                max = std::max<std::uint64_t>(max, (std::is_signed_v<T> && el < T(0)) ? 0ull - u : u);
+                                            }
+                                            return max;
+                                        }};
+
+                constexpr uint128_t halfP123{static_cast<uint128_t>(kNttPrimes[0]) * kNttPrimes[1] * kNttPrimes[2] / 2u};
+                uint128_t bound{static_cast<uint128_t>(maxMagnitude(a)) * maxMagnitude(b)};
+                return !__builtin_mul_overflow(bound, static_cast<uint128_t>(std::min(a.size(), b.size())), &bound) &&
+                       bound < halfP123;
+            }
+
+            /**
+             * @brief Multiplication of the integer polynomials with NTT modulo three primes and
+             * Chinese remainder theorem, O((n + m) * log(n + m)). Result is exact while the absolute values
+             * of the coefficients of the product are less than p1 * p2 * p3 / 2 (about 2^85, see 'isNttExact()'),
+             * then it's wrapped to 'T'.
+             * @param a first polynomial
+             * @param b second polynomial
+             * @param out destination of size a.size() + b.size() - 1
+             */
+            template <std::integral T>
+            void multiplyNTT(std::span<std::type_identity_t<T> const> a, std::span<std::type_identity_t<T> const> b,
+                             std::span<T> out)
+            {
+                if (a.empty() || b.empty())
+                    return;
+
+                constexpr std::uint64_t p1{kNttPrimes[0]}, p2{kNttPrimes[1]}, p3{kNttPrimes[2]};
+                size_t const resSize{a.size() + b.size() - 1ul}, n{std::bit_ceil(resSize)};
+                if (n > kNttMaxLength)
+                    throw std::length_error("polynomial::multiplyNTT(): polynomials are too long");
+
+                auto const r1{nttProduct<p1, 3ull, T>(a, b, n)};
+                auto const r2{nttProduct<p2, 3ull, T>(a, b, n)};
+                auto const r3{nttProduct<p3, 3ull, T>(a, b, n)};
+
+                constexpr uint128_t p123{static_cast<uint128_t>(p1) * p2 * p3};
+                for (size_t i{}; i < resSize; i++)
+                {
+                    uint128_t x{crt3(r1[i], r2[i], r3[i])};
+
+                    // Negative values are represented as x - p1 * p2 * p3, truncation wraps them into 'T'
+                    if (std::is_signed_v<T> && x > p123 / 2u)
+                        x -= p123;
+                    out[i] = static_cast<T>(static_cast<std::make_unsigned_t<T>>(x));
+                }
+            }
+
+            /**
+             * @brief In-place iterative radix-2 fast Fourier transform
+             * @param a sequence of the size that is a power of 2
+             * @param invert "true" for the inverse transform (result is divided by size)
+             */
+            template <std::floating_point F>
+            void fft(std::span<std::complex<F>> a, bool invert)
+            {
+                size_t const n{a.size()};
+                for (size_t i{1ul}, j{}; i < n; i++)
+                {
+                    size_t bit{n >> 1ul};
+                    for (; j & bit; bit >>= 1ul)
+                        j ^= bit;
+                    j ^= bit;
+                    if (i < j)
+                        std::swap(a[i], a[j]);
+                }
+
+                std::vector<std::complex<F>> roots(n / 2ul + 1ul);
+                for (size_t len{2ul}; len <= n; len <<= 1ul)
+                {
+                    // Roots are computed directly (not by repeated multiplication) to keep precision
+                    F const angle{(invert ? F(2) : F(-2)) * std::numbers::pi_v<F> / static_cast<F>(len)};
+                    for (size_t k{}; k < len / 2ul; k++)
+                        roots[k] = std::polar(F(1), angle * static_cast<F>(k));
+
+                    for (size_t i{}; i < n; i += len)
+                        for (size_t k{}; k < len / 2ul; k++)
+                        {
+                            std::complex<F> const u{a[i + k]}, v{a[i + k + len / 2ul] * roots[k]};
+                            a[i + k] = u + v;
+                            a[i + k + len / 2ul] = u - v;
+                        }
+                }
+
+                if (invert)
+                    for (auto &el : a)
+                        el /= static_cast<F>(n);
+            }
+
+            /**
+             * @brief Multiplication of the floating polynomials with FFT, O((n + m) * log(n + m)).
+             * Calculations are at least in double precision.
+             * @param a first polynomial
+             * @param b second polynomial
+             * @param out destination of size a.size() + b.size() - 1
+             */
+            template <std::floating_point T>
+            void multiplyFFT(std::span<std::type_identity_t<T> const> a, std::span<std::type_identity_t<T> const> b,
+                             std::span<T> out)
+            {
+                if (a.empty() || b.empty())
+                    return;
+
+                using F = std::conditional_t<(sizeof(T) > sizeof(double)), T, double>;
+                size_t const n{std::bit_ceil(a.size() + b.size() - 1ul)};
+
+                // Both polynomials are packed into one complex sequence: a + i*b, then
+                // (a + ib)^2 = a^2 - b^2 + 2iab, so the product is a half of imaginary part
+                std::vector<std::complex<F>> fa(n);
+                for (size_t i{}; i < a.size(); i++)
+                    fa[i].real(a[i]);
+                for (size_t i{}; i < b.size(); i++)
+                    fa[i].imag(b[i]);
+
+                fft<F>(fa, false);
+                for (auto &el : fa)
+                    el *= el;
+                fft<F>(fa, true);
+
+                for (size_t i{}; i < out.size(); i++)
+                    out[i] = static_cast<T>(fa[i].imag() / F(2));
+            }
+
+            /**
+             * @brief Multiplies polynomials choosing the algorithm by their sizes: schoolbook for short ones,
+             * Karatsuba for middle ones, NTT (integers whose product is exact, see 'isNttExact()') or FFT (floating)
+             * for long ones
+             * @param a first polynomial
+             * @param b second polynomial
+             * @param out destination of size a.size() + b.size() - 1, mustn't overlap with 'a' and 'b'
+             */
+            template <typename T>
+            void multiply(std::span<std::type_identity_t<T> const> a, std::span<std::type_identity_t<T> const> b,
+                          std::span<T> out)
+            {
+                if (a.empty() || b.empty())
+                {
+                    std::ranges::fill(out, T(0));
+                    return;
+                }
+                if (out.size() != a.size() + b.size() - 1ul)
+                    throw std::invalid_argument("polynomial::multiply(): size of the destination doesn't match");
+
+                size_t const shorter{std::min(a.size(), b.size())};
+                if (shorter < 32ul)
+                    multiplySchoolbook<T>(a, b, out);
+                else if constexpr (std::is_integral_v<T>)
+                {
+                    // Wrapping modulo 2^N needs the exact product, NTT gives it only for small enough coefficients
+                    if (shorter >= 512ul && isNttExact<T>(a, b))
+                        multiplyNTT<T>(a, b, out);
+                    else
+                        multiplyKaratsuba<T>(a, b, out);
+                }
+                else if constexpr (std::is_floating_point_v<T>)
+                    (shorter < 128ul) ? multiplyKaratsuba<T>(a, b, out) : multiplyFFT<T>(a, b, out);
+                else
+                    multiplyKaratsuba<T>(a, b, out);
+            }
+
+            /**
+             * @brief Returns product of the polynomials (see 'multiply(a, b, out)')
+             * @param a first polynomial
+             * @param b second polynomial
+             * @return Product of the polynomials
+             */
+            template <typename T>
+            std::vector<T> multiply(std::span<std::type_identity_t<T> const> a, std::span<std::type_identity_t<T> const> b)
+            {
+                if (a.empty() || b.empty())
+                    return {};
+                std::vector<T> res(a.size() + b.size() - 1ul);
+                multiply<T>(a, b, std::span<T>(res));
+                return res;
+            }
+
+            /// @brief Returns product of the polynomials stored in contiguous ranges of the same type (e.g. vectors)
+            template <std::ranges::contiguous_range A, std::ranges::contiguous_range B>
+                requires std::same_as<std::ranges::range_value_t<A>, std::ranges::range_value_t<B>>
+            std::vector<std::ranges::range_value_t<A>> multiply(A const &a, B const &b)
+            {
+                return multiply<std::ranges::range_value_t<A>>(a, b);
+            }
+
+            /**
+             * @brief Evaluates polynomial at the point with Horner's method
+             * @param coefs polynomial
+             * @param x point
+             * @return Value of the polynomial at the point 'x'
+             */
+            template <typename T>
+            constexpr T evaluate(std::span<std::type_identity_t<T> const> coefs, T x)
+            {
+                T res(0);
+                for (T const &c : coefs)
+                    res = res * x + c;
+                return res;
+            }
+
+            /**
+             * @brief Evaluates polynomial at many points. Points are processed by groups of 8 with
+             * independent Horner's chains, so the loop over the group is vectorized.
+             * @param coefs polynomial
+             * @param xs points
+             * @param out destination for the values, size must be equal to the count of the points
+             */
+            template <typename T>
+            void evaluate(std::span<std::type_identity_t<T> const> coefs, std::span<std::type_identity_t<T> const> xs,
+                          std::span<T> out)
+            {
+                if (xs.size() != out.size())
+                    throw std::invalid_argument("polynomial::evaluate(): count of points and values don't match");
+
+                constexpr size_t kLanes{8ul};
+                size_t const body{xs.size() / kLanes * kLanes};
+                for (size_t i{}; i < body; i += kLanes)
+                {
+                    T acc[kLanes]{}, x[kLanes];
+                    std::copy_n(xs.begin() + i, kLanes, x);
+                    for (T const &c : coefs)
+                        for (size_t l{}; l < kLanes; l++)
+                            acc[l] = acc[l] * x[l] + c;
+                    std::copy_n(acc, kLanes, out.begin() + i);
+                }
+                for (size_t i{body}; i < xs.size(); i++)
+                    out[i] = evaluate<T>(coefs, xs[i]);
+            }
+        }
+
+        /**
+         * @brief Calculates sum of the matrices.
+         * @tparam a - 1st matrix.
+         * @tparam b - 2nd matrix.
+         * @return Matrix where all elements are summarized (a + b).
+         */
+        template <std::integral T>
+        std::vector<std::vector<T>> sumOfTheMatrices(Matrix<T> auto const &a, Matrix<T> auto const &b);
+
+        /**
+         * @brief Transposes matrix
+         * @tparam T restictions: constructible, copy/move-assignable
+         * @tparam matrix matrix to transpose
+         * @return Transposed matrix as vector of vectors
+         */
+        template <typename T>
+        std::vector<std::vector<T>> transposeMatrix(Matrix<T> auto const &matrix);
+
+        /**
+         * @brief Transposes matrix 'src' into 'dst' with cache blocking: matrix is processed
+         * by 64x64 blocks which are split to 8x8 tiles, so both reading and writing stay within few cache lines
+         * @param src matrix to transpose (rows x cols)
+         * @param dst destination matrix (cols x rows), mustn't overlap with 'src'
+         */
+        template <typename T>
+        void transpose(MatrixView<std::type_identity_t<T> const> src, MatrixView<T> dst)
+        {
+            if (src.rows() != dst.cols() || src.cols() != dst.rows())
+                throw std::invalid_argument("transpose(): shape of the destination doesn't match");
+
+            constexpr size_t kBlock{64ul}, kTile{8ul};
+            size_t const rows{src.rows()}, cols{src.cols()};
+            T const *const s{src.data()};
+            T *const d{dst.data()};
+            size_t const ss{src.stride()}, ds{dst.stride()};
+
+            for (size_t ib{}; ib < rows; ib += kBlock)
+                for (size_t jb{}; jb < cols; jb += kBlock)
+                {
+                    size_t const iEnd{std::min(ib + kBlock, rows)}, jEnd{std::min(jb + kBlock, cols)};
+                    for (size_t it{ib}; it < iEnd; it += kTile)
+                        for (size_t jt{jb}; jt < jEnd; jt += kTile)
+                        {
+                            // Full tile has constant bounds, so compiler unrolls and vectorizes it
+                            if (it + kTile <= iEnd && jt + kTile <= jEnd)
+                            {
+                                for (size_t i{}; i < kTile; i++)
+                                    for (size_t j{}; j < kTile; j++)
+                                        d[(jt + j) * ds + it + i] = s[(it + i) * ss + jt + j];
+                            }
+                            else
+                            {
+                                for (size_t i{it}; i < std::min(it + kTile, iEnd); i++)
+                                    for (size_t j{jt}; j < std::min(jt + kTile, jEnd); j++)
+                                        d[j * ds + i] = s[i * ss + j];
+                            }
+                        }
+                }
+        }
+
+        /**
+         * @brief Transposes dense matrix (see 'transpose(MatrixView<T const>, MatrixView<T>)')
+         * @param matrix matrix to transpose
+         * @return Transposed matrix
+         */
+        template <typename T>
+        DenseMatrix<T> transpose(DenseMatrix<T> const &matrix)
+        {
+            DenseMatrix<T> res(matrix.cols(), matrix.rows());
+            transpose(matrix.view(), res.view());
+            return res;
+        }
+
+        /**
+         * @brief Block sizes of the matrix multiplication for type 'T'.
+         * Micro-kernel keeps 'MR' x 'NR' block of the result in registers, packed 'KC' x 'NR' panel
+         * of the right matrix stays in L1, packed 'MC' x 'KC' block of the left matrix - in L2.
+         */
+        template <typename T>
+        struct GemmBlocking
+        {
+#ifdef __AVX2__
+            static constexpr size_t MR{6ul}; // 6 x 2 vector accumulators out of 16 AVX registers
+#else
+            static constexpr size_t MR{4ul};
+#endif
+            static constexpr size_t NR{std::max<size_t>(64ul / sizeof(T), 4ul)};
+            static constexpr size_t KC{256ul};
+            static constexpr size_t MC{128ul};
+            static constexpr size_t NC{2048ul};
+        };
+
+        /**
+         * @brief Auxiliary method for matrix multiplication. Packs block of the left matrix into
+         * row panels of 'MR' rows, so micro-kernel reads it sequentially. Missing rows are zero-padded.
+         * @param a block of the left matrix (mc x kc)
+         * @param dst destination buffer of size at least ceil(mc / MR) * MR * kc
+         */
+        template <typename T>
+        void gemmPackA(MatrixView<T const> a, T *dst)
+        {
+            constexpr size_t MR{GemmBlocking<T>::MR};
+            for (size_t i0{}; i0 < a.rows(); i0 += MR)
+            {
+                size_t const mr{std::min(MR, a.rows() - i0)};
+                for (size_t k{}; k < a.cols(); k++)
+                    for (size_t i{}; i < MR; i++)
+                        *dst++ = (i < mr) ? a(i0 + i, k) : T(0);
+            }
+        }
+
+        /**
+         * @brief Auxiliary method for matrix multiplication. Packs block of the right matrix into
+         * column panels of 'NR' columns, so micro-kernel reads it sequentially. Missing columns are zero-padded.
+         * @param b block of the right matrix (kc x nc)
+         * @param dst destination buffer of size at least ceil(nc / NR) * NR * kc
+         */
+        template <typename T>
+        void gemmPackB(MatrixView<T const> b, T *dst)
+        {
+            constexpr size_t NR{GemmBlocking<T>::NR};
+            for (size_t j0{}; j0 < b.cols(); j0 += NR)
+            {
+                size_t const nr{std::min(NR, b.cols() - j0)};
+                for (size_t k{}; k < b.rows(); k++)
+                {
+                    T const *const row{b[k].data() + j0};
+                    for (size_t j{}; j < NR; j++)
+                        *dst++ = (j < nr) ? row[j] : T(0);
+                }
+            }
+        }
+
+        /**
+         * @brief Auxiliary method for matrix multiplication. Register-blocked micro-kernel:
+         * C[0:mr, 0:nr] += A_panel * B_panel. All loops have constant bounds, so accumulators are
+         * kept in registers and the inner loop is vectorized by the compiler (FMA if target has it).
+         * @param kc depth of the panels
+         * @param a packed panel of the left matrix (MR x kc)
+         * @param b packed panel of the right matrix (kc x NR)
+         * @param c result block
+         * @param mr count of valid rows in result block
+         * @param nr count of valid columns in result block
+         */
+        template <typename T>
+        void gemmMicroKernel(size_t kc, T const *a, T const *b, MatrixView<T> c, size_t mr, size_t nr)
+        {
+            constexpr size_t MR{GemmBlocking<T>::MR}, NR{GemmBlocking<T>::NR};
+
+            T acc[MR][NR]{};
+            for (size_t k{}; k < kc; k++, a += MR, b += NR)
+                for (size_t i{}; i < MR; i++)
+                {
+                    T const ai{a[i]};
+                    for (size_t j{}; j < NR; j++)
+                        acc[i][j] += ai * b[j];
+                }
+
+            for (size_t i{}; i < mr; i++)
+                for (size_t j{}; j < nr; j++)
+                    c(i, j) += acc[i][j];
+        }
+
+        /**
+         * @brief Auxiliary method for matrix multiplication. Single-threaded blocked GEMM: C = A * B
+         * @param a left matrix (m x k)
+         * @param b right matrix (k x n)
+         * @param c result matrix (m x n)
+         */
+        template <typename T>
+        void gemmSerial(MatrixView<T const> a, MatrixView<T const> b, MatrixView<T> c)
+        {
+            using blk = GemmBlocking<T>;
+            size_t const m{a.rows()}, n{b.cols()}, k{a.cols()};
+
+            for (auto row : c)
+                std::ranges::fill(row, T(0));
+            if (m == 0ul || n == 0ul || k == 0ul)
+                return;
+
+            // Buffers for the packed blocks are allocated once per call
+            size_t const nc{std::min(blk::NC, n)}, mc{std::min(blk::MC, m)}, kc{std::min(blk::KC, k)};
+            std::vector<T> packedB((nc + blk::NR - 1ul) / blk::NR * blk::NR * kc),
+                packedA((mc + blk::MR - 1ul) / blk::MR * blk::MR * kc);
+
+            for (size_t jc{}; jc < n; jc += blk::NC)
+            {
+                size_t const ncur{std::min(blk::NC, n - jc)};
+                for (size_t pc{}; pc < k; pc += blk::KC)
+                {
+                    size_t const kcur{std::min(blk::KC, k - pc)};
+                    gemmPackB(b.submatrix(pc, jc, kcur, ncur), packedB.data());
+
+                    for (size_t ic{}; ic < m; ic += blk::MC)
+                    {
+                        size_t const mcur{std::min(blk::MC, m - ic)};
+                        gemmPackA(a.submatrix(ic, pc, mcur, kcur), packedA.data());
+
+                        // Walking over the result block by 'MR' x 'NR' micro-tiles
+                        for (size_t jr{}; jr < ncur; jr += blk::NR)
+                            for (size_t ir{}; ir < mcur; ir += blk::MR)
+                            {
+                                size_t const mr{std::min(blk::MR, mcur - ir)}, nr{std::min(blk::NR, ncur - jr)};
+                                gemmMicroKernel(kcur, packedA.data() + ir * kcur, packedB.data() + jr * kcur,
+                                                c.submatrix(ic + ir, jc + jr, mr, nr), mr, nr);
+                            }
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Matrix multiplication C = A * B with packing, cache blocking and register-blocked
+         * micro-kernel. Rows of the result are split between threads by stripes of micro-tiles.
+         * @param a left matrix (m x k)
+         * @param b right matrix (k x n)
+         * @param c result matrix (m x n), mustn't overlap with 'a' and 'b'
+         * @param threads count of threads, 0 - choose automatically by size of the matrices
+         */
+        template <typename T>
+            requires std::is_arithmetic_v<T>
+        void matmul(MatrixView<std::type_identity_t<T> const> a, MatrixView<std::type_identity_t<T> const> b,
+                    MatrixView<T> c, unsigned threads = 0u)
+        {
+            if (a.cols() != b.rows() || c.rows() != a.rows() || c.cols() != b.cols())
+                throw std::invalid_argument("matmul(): shapes of the matrices don't match");
+
+            constexpr size_t MR{GemmBlocking<T>::MR};
+            size_t const m{a.rows()};
+
+            // Small products aren't worth starting threads
+            if (threads == 0u)
+                threads = (m * b.cols() * a.cols() < (1ul << 21ul)) ? 1u : std::thread::hardware_concurrency();
+            size_t const stripes{std::clamp<size_t>(threads, 1ul, std::max<size_t>((m + MR - 1ul) / MR, 1ul))};
+            if (stripes == 1ul)
+                return gemmSerial(a, b, c);
+
+            // Every thread computes its own stripe of rows, stripe height is a multiple of 'MR'
+            size_t const height{((m + stripes - 1ul) / stripes + MR - 1ul) / MR * MR};
+            std::vector<std::jthread> workers;
+            workers.reserve(stripes);
+            for (size_t row{}; row < m; row += height)
+            {
+                size_t const rows{std::min(height, m - row)};
+                workers.emplace_back([=]()
+                                     { gemmSerial(a.submatrix(row, 0ul, rows, a.cols()), b,
+                                                  c.submatrix(row, 0ul, rows, c.cols())); });
+            }
+        }
+
+        /**
+         * @brief Matrix multiplication of the dense matrices (see 'matmul(MatrixView, MatrixView, MatrixView, unsigned)')
+         * @param a left matrix (m x k)
+         * @param b right matrix (k x n)
+         * @param threads count of threads, 0 - choose automatically by size of the matrices
+         * @return Product of the matrices (m x n)
+         */
+        template <typename T>
+            requires std::is_arithmetic_v<T>
+        DenseMatrix<T> matmul(DenseMatrix<T> const &a, DenseMatrix<T> const &b, unsigned threads = 0u)
+        {
+            DenseMatrix<T> c(a.rows(), b.cols());
+            matmul<T>(a.view(), b.view(), c.view(), threads);
+            return c;
+        }
+
+        /**
+         * @brief Matrix-vector product y = A * x. Each row is reduced with several independent
+         * accumulators to break the dependency chain, so the loop is vectorized.
+         * @param a matrix (m x n)
+         * @param x vector of size n
+         * @param y result vector of size m
+         * @param threads count of threads, 0 - choose automatically by size of the matrix
+         */
+        template <typename T>
+            requires std::is_arithmetic_v<T>
+        void matvec(MatrixView<std::type_identity_t<T> const> a, std::span<std::type_identity_t<T> const> x,
+                    std::span<T> y, unsigned threads = 0u)
+        {
+            if (a.cols() != x.size() || a.rows() != y.size())
+                throw std::invalid_argument("matvec(): sizes of the matrix and vectors don't match");
+
+            auto const rowsProduct{[a, x, y](size_t first, size_t last)
+                                   {
+                                       constexpr size_t kLanes{8ul};
+                                       size_t const n{a.cols()}, body{n / kLanes * kLanes};
+                                       for (size_t i{first}; i < last; i++)
+                                       {
+                                           T const *const row{a[i].data()};
+                                           T acc[kLanes]{};
+                                           for (size_t j{}; j < body; j += kLanes)
+                                               for (size_t l{}; l < kLanes; l++)
+                                                   acc[l] += row[j + l] * x[j + l];
+
+                                           T sum{std::accumulate(std::begin(acc), std::end(acc), T(0))};
+                                           for (size_t j{body}; j < n; j++)
+                                               sum += row[j] * x[j];
+                                           y[i] = sum;
+                                       }
+                                   }};
+
+            size_t const m{a.rows()};
+            if (threads == 0u)
+                threads = (m * a.cols() < (1ul << 20ul)) ? 1u : std::thread::hardware_concurrency();
+            size_t const parts{std::clamp<size_t>(threads, 1ul, std::max(m, 1ul))};
+            if (parts == 1ul)
+                return rowsProduct(0ul, m);
+
+            std::vector<std::jthread> workers;
+            workers.reserve(parts);
+            for (size_t p{}; p < parts; p++)
+                workers.emplace_back(rowsProduct, m * p / parts, m * (p + 1ul) / parts);
+        }
+
+        /**
+         * @brief Matrix-vector product of the dense matrix and vector
+         * @param a matrix (m x n)
+         * @param x vector of size n
+         * @param threads count of threads, 0 - choose automatically by size of the matrix
+         * @return Result vector of size m
+         */
+        template <typename T>
+            requires std::is_arithmetic_v<T>
+        std::vector<T> matvec(DenseMatrix<T> const &a, std::span<std::type_identity_t<T> const> x, unsigned threads = 0u)
+        {
+            std::vector<T> y(a.rows());
+            matvec<T>(a.view(), x, std::span<T>(y), threads);
+            return y;
+        }
+
+        /**
+         * @brief Calculates product of the matrices represented as vectors of rows
+         * (see 'matmul(MatrixView, MatrixView, MatrixView, unsigned)')
+         * @tparam a - left matrix (m x k).
+         * @tparam b - right matrix (k x n).
+         * @return Product of the matrices (m x n).
+         */
+        template <typename T>
+            requires std::is_arithmetic_v<T>
+        std::vector<std::vector<T>> productOfTheMatrices(Matrix<T> auto const &a, Matrix<T> auto const &b)
+        {
+            return matmul(DenseMatrix<T>::fromRows(a), DenseMatrix<T>::fromRows(b)).toRows();
+        }
+
+        /**
+         * @brief Searches common prefix in sequence of strings.
+         * @tparam strings sequence of strings
+         * @return Common prefix in all passed strings
+         */
+        template <StringConvertible T>
+        std::string commonPrefix(std::span<T const> strings);
+
+        /**
+         * @brief Finds common letters in a sequence of words
+         * @param words sequence of words
+         * @return Common letters as a word ("std::string" instance)
+         */
+        std::string commonLetters(std::vector<std::string> const &words);
+
+        /**
+         * @brief Joins passed strings with passed delimiter.
+         * @param tokens strings to be combined.
+         * @param delim delimiter by which they would joining.
+         * @return String composed from passed range of strings with specified delimiter.
+         */
+        std::string join(std::span<std::string_view> tokens, std::string_view delim);
+
+        /**
+         * @brief Gets all non-empty dirs and subdirs
+         * @param dirs path to directories
+         * @return Set of non-empty directories in lexicographical order
+         *
+         * Example of usage:
+         * std::vector<std::string> dirs;
+         * std::string path;
+         * while (std::getline(std::cin, path))
+         *     dirs.emplace_back(path);
+         * for (std::string_view dir : extractNonEmptyDirs(dirs))
+         *     std::cout << dir << '\n';
+         */
+        std::vector<std::string> extractNonEmptyDirs(std::vector<std::string> dirs);
+
+        /**
+         * @brief Calculate the frequencies of symbolic n-grams in a text
+         * @param words list of words
+         * @param lengthOfNGramm length of each n-gram
+         * @return Vector of words and their frequencies correspondingly.
+         * Vector sorted by frequencies if freqs are equal - lexicograpically sorted
+         */
+        std::vector<std::pair<std::string, int>> calculateNGramFrequencies(std::vector<std::string> const &words,
+                                                                           size_t lengthOfNGramm);
+
+        /**
+         * @brief Duplicates vector elements to itself
+         * @tparam v vector to duplicate
+         */
+        template <typename T>
+        void duplicateVector(std::vector<T> &v);
+
+        /**
          * @brief Approximate Binary Search between two vectors.
          * This function performs an approximate binary search between two sorted vectors.
          * It finds the closest value in `vec1` for each element in `vec2`.
@@ -807,143 +3490,1426 @@ namespace lvt
          * @param vec2 Second vector for which approximate search is performed
          * @return A vector containing the closest values from `vec1` for each element in `vec2`
          */
-        template <typename T>
-        std::vector<T> ApproxBinSearch(std::span<T const> vec1, std::span<T const> vec2);
+        template <typename T>
+        std::vector<T> ApproxBinSearch(std::span<T const> vec1, std::span<T const> vec2);
+
+        /**
+         * @brief Comparator for the map
+         * @tparam Map template parameter that defines map
+         * @param lhs first map
+         * @param rhs second map
+         * @return `true` if sizes and contents of the both maps are equal, otherwise `false`.
+         */
+        template <typename Map>
+        constexpr bool map_compare(Map const &lhs, Map const &rhs);
+    }
+
+    /**
+     * @brief Arbitrary-precision signed integer.
+     * Magnitude is stored as a little-endian array of 64-bit limbs (19 decimal digits per limb),
+     * values up to 128 bits are kept inside the object without heap allocations.
+     * Carries and partial products are calculated with 128-bit integers. Binary operators take
+     * left operand by value, so temporaries are reused: 'a * b + c' makes only one allocation.
+     * Division truncates toward zero (like built-in integers).
+     *
+     * Example of usage:
+     * BigInt a("123456789012345678901234567890"), b(42);
+     * std::cout << a * b - 1 << '\n';
+     */
+    class BigInt
+    {
+    public:
+        using limb_t = std::uint64_t;
+
+        /// @brief Sizes of the operands (in limbs) from which faster multiplication algorithms are used
+        struct MulThresholds
+        {
+            size_t karatsuba; ///< Schoolbook -> Karatsuba
+            size_t toom3;     ///< Karatsuba -> Toom-Cook 3
+            size_t ntt;       ///< Toom-Cook 3 -> three-prime NTT
+        };
+
+    private:
+        static constexpr size_t kInlineLimbs{2ul};
+
+        limb_t m_inline[kInlineLimbs]{};
+        std::unique_ptr<limb_t[]> m_heap;
+        size_t m_size{}, m_capacity{kInlineLimbs};
+        bool m_negative{false};
+
+        limb_t *data() noexcept { return m_heap ? m_heap.get() : m_inline; }
+        limb_t const *data() const noexcept { return m_heap ? m_heap.get() : m_inline; }
+
+        /// @brief Grows capacity keeping the value
+        void reserve(size_t capacity);
+
+        /// @brief Changes count of limbs, new limbs are zeroed
+        void resize(size_t size);
+
+        /// @brief Removes leading zero limbs, zero always becomes non-negative
+        void normalize() noexcept;
+
+        /// @brief Adds 'other' to this with sign of 'other' replaced by 'negative'
+        void addSigned(BigInt const &other, bool negative);
+
+        /// @brief Compares absolute values: returns -1, 0 or 1
+        static int compareMagnitude(BigInt const &a, BigInt const &b) noexcept;
+
+        /// @brief r = a + b, na >= nb, 'r' has na limbs and may alias 'a' or 'b'. Returns carry
+        static limb_t addRaw(limb_t *r, limb_t const *a, size_t na, limb_t const *b, size_t nb) noexcept;
+
+        /// @brief r = a - b, a >= b, 'r' has na limbs and may alias 'a' or 'b'
+        static void subRaw(limb_t *r, limb_t const *a, size_t na, limb_t const *b, size_t nb) noexcept;
+
+        /// @brief Makes non-negative number from 'n' limbs, the least significant first
+        static BigInt fromLimbs(limb_t const *limbs, size_t n);
+
+        /**
+         * @brief r = a * b, 'r' has na + nb limbs and mustn't alias 'a' and 'b'.
+         * Chooses algorithm by the size of operands and 'thresholds', when 'a' and 'b' are the same range it squares.
+         */
+        static void mulRaw(limb_t *r, limb_t const *a, size_t na, limb_t const *b, size_t nb, MulThresholds const &thresholds);
+
+        /// @brief O(na * nb) schoolbook multiplication
+        static void mulSchoolbook(limb_t *r, limb_t const *a, size_t na, limb_t const *b, size_t nb) noexcept;
+
+        /// @brief Schoolbook squaring: every cross product is calculated once, so it's almost 2 times faster
+        static void sqrSchoolbook(limb_t *r, limb_t const *a, size_t n) noexcept;
+
+        /// @brief O(n^1.58) Karatsuba multiplication, requires na >= nb > (na + 1) / 2
+        static void mulKaratsuba(limb_t *r, limb_t const *a, size_t na, limb_t const *b, size_t nb, MulThresholds const &thresholds);
+
+        /// @brief O(n^1.46) Toom-Cook 3-way multiplication with Bodrato's interpolation, requires na >= nb > (na + 1) / 2
+        static void mulToom3(limb_t *r, limb_t const *a, size_t na, limb_t const *b, size_t nb, MulThresholds const &thresholds);
+
+        /// @brief O(n * log(n)) multiplication with NTT modulo three primes over 32-bit pieces of limbs
+        static void mulNTT(limb_t *r, limb_t const *a, size_t na, limb_t const *b, size_t nb);
+
+        /// @brief q = a / d, returns a % d. 'q' has na limbs and may alias 'a'
+        static limb_t divSmallRaw(limb_t *q, limb_t const *a, size_t na, limb_t d) noexcept;
+
+        /// @brief Knuth's algorithm D: q = a / b, r = a % b for na >= nb >= 2
+        static void divModRaw(limb_t *q, limb_t *r, limb_t const *a, size_t na, limb_t const *b, size_t nb);
+
+    public:
+        BigInt() noexcept = default;
+
+        // 128-bit integers are 'std::integral' in GNU mode, they are handled by the constructors below
+        template <std::integral I>
+            requires(sizeof(I) <= sizeof(limb_t))
+        BigInt(I value) noexcept
+        {
+            if constexpr (std::is_signed_v<I>)
+            {
+                m_negative = value < 0;
+                m_inline[0] = m_negative ? 0ull - static_cast<limb_t>(value) : static_cast<limb_t>(value);
+            }
+            else
+                m_inline[0] = static_cast<limb_t>(value);
+            m_size = (m_inline[0] != 0ull) ? 1ul : 0ul;
+        }
+
+        BigInt(uint128_t value) noexcept;
+        BigInt(int128_t value) noexcept;
+
+        /**
+         * @brief Parses decimal number with optional sign. Long numbers are parsed by divide and conquer.
+         * @param str string with decimal number, e.g. "-1234567890123456789012345"
+         * @throw std::invalid_argument if string isn't a decimal number
+         */
+        explicit BigInt(std::string_view str);
+
+        BigInt(BigInt const &other);
+        BigInt(BigInt &&other) noexcept;
+        BigInt &operator=(BigInt const &other);
+        BigInt &operator=(BigInt &&other) noexcept;
+        ~BigInt() = default;
+
+        /// @brief Returns limbs of the absolute value, the least significant first
+        std::span<limb_t const> magnitude() const noexcept { return std::span<limb_t const>(data(), m_size); }
+
+        bool isZero() const noexcept { return m_size == 0ul; }
+        bool isNegative() const noexcept { return m_negative; }
+        explicit operator bool() const noexcept { return !isZero(); }
+
+        /// @brief Returns count of bits in the absolute value
+        size_t bitLength() const noexcept;
+
+        /**
+         * @brief Converts number to decimal string. Long numbers are converted by divide and conquer:
+         * number is split by powers 10^(19 * 2^k) into parts that are converted independently.
+         */
+        std::string toString() const;
+
+        /// @brief Returns square of the number, squaring is faster than multiplication of the different numbers
+        BigInt square() const;
+
+        /// @brief Returns base^exp
+        static BigInt pow(BigInt base, std::uint64_t exp);
+
+        /// @brief Returns thresholds that are currently used by multiplication
+        static MulThresholds mulThresholds() noexcept;
+
+        /// @brief Sets thresholds of multiplication. Every threshold is valid, it affects only performance.
+        static void setMulThresholds(MulThresholds const &thresholds) noexcept;
+
+        /**
+         * @brief Calibration benchmark: measures crossover points of the multiplication algorithms on this machine.
+         * Takes a few seconds. Each threshold is the smallest size from which the faster algorithm wins
+         * twice in a row (against the previous ones with already measured thresholds).
+         * @param apply "true" to use measured thresholds for further multiplications
+         * @return Measured thresholds
+         */
+        static MulThresholds calibrateMulThresholds(bool apply = true);
+
+        /**
+         * @brief Calculates quotient and remainder at once
+         * @return Pair {a / b, a % b}
+         * @throw std::domain_error on division by zero
+         */
+        static std::pair<BigInt, BigInt> divMod(BigInt const &a, BigInt const &b);
+
+        BigInt &operator+=(BigInt const &other);
+        BigInt &operator-=(BigInt const &other);
+        BigInt &operator*=(BigInt const &other);
+        BigInt &operator/=(BigInt const &other);
+        BigInt &operator%=(BigInt const &other);
+
+        /// @brief Shifts absolute value, sign is kept
+        BigInt &operator<<=(size_t bits);
+        BigInt &operator>>=(size_t bits);
+
+        BigInt &operator++() { return *this += BigInt(1); }
+        BigInt &operator--() { return *this -= BigInt(1); }
+
+        BigInt operator-() const &
+        {
+            BigInt res(*this);
+            res.m_negative = !res.m_negative && !res.isZero();
+            return res;
+        }
+        BigInt operator-() &&
+        {
+            m_negative = !m_negative && !isZero();
+            return std::move(*this);
+        }
+
+        friend BigInt operator+(BigInt a, BigInt const &b) { return std::move(a += b); }
+        friend BigInt operator-(BigInt a, BigInt const &b) { return std::move(a -= b); }
+        friend BigInt operator*(BigInt a, BigInt const &b) { return std::move(a *= b); }
+        friend BigInt operator/(BigInt a, BigInt const &b) { return std::move(a /= b); }
+        friend BigInt operator%(BigInt a, BigInt const &b) { return std::move(a %= b); }
+        friend BigInt operator<<(BigInt a, size_t bits) { return std::move(a <<= bits); }
+        friend BigInt operator>>(BigInt a, size_t bits) { return std::move(a >>= bits); }
+
+        friend bool operator==(BigInt const &a, BigInt const &b) noexcept
+        {
+            return a.m_negative == b.m_negative && compareMagnitude(a, b) == 0;
+        }
+        friend std::strong_ordering operator<=>(BigInt const &a, BigInt const &b) noexcept
+        {
+            if (a.m_negative != b.m_negative)
+                return a.m_negative ? std::strong_ordering::less : std::strong_ordering::greater;
+
+            // For negative numbers bigger magnitude means smaller number
+            int const cmp{a.m_negative ? compareMagnitude(b, a) : compareMagnitude(a, b)};
+            return cmp <=> 0;
+        }
+        friend std::ostream &operator<<(std::ostream &os, BigInt const &num) { return os << num.toString(); }
+    };
+
+    namespace big_numbers
+    {
+        // Calculates sum of 2 big numbers represented as array of integer
+        void sum(const std::vector<int> &, const std::vector<int> &, std::vector<int> &);
+
+        // Calculates product of 2 big numbers represented as array of integer
+        void product(const std::vector<int> &, const std::vector<int> &, std::vector<int> &);
+
+        // Returns factorial of number
+        std::string factorial(int);
+
+        /**
+         * @brief Product of the numbers by the product tree: factors are packed into 64-bit words, then
+         * halves of the sequence are multiplied recursively, so the operands of every multiplication have
+         * similar sizes and sub-quadratic multiplication pays off. Subtrees are multiplied in parallel.
+         * @param factors sequence of the factors
+         * @param threads count of threads to use
+         * @return Product of all of the factors, 1 for the empty sequence
+         */
+        BigInt productTree(std::span<std::uint64_t const> factors, unsigned threads = std::thread::hardware_concurrency());
+
+        /**
+         * @brief Product of the consecutive numbers by binary splitting (see 'productTree()')
+         * @return a * (a + 1) * ... * b, 1 if a > b
+         */
+        BigInt productRange(std::uint64_t a, std::uint64_t b, unsigned threads = std::thread::hardware_concurrency());
+
+        /**
+         * @brief Factorial by the prime swing algorithm: n! = ((n / 2)!)^2 * swing(n). Swing number
+         * swing(n) = n! / ((n / 2)!)^2 is the product of powers of primes up to 'n', where power of 'p' is
+         * sum of the parities of n / p^k. Such decomposition replaces most of the multiplications by squarings.
+         * @param n number
+         * @param threads count of threads for the product trees of swing numbers
+         * @return n!
+         */
+        BigInt primeSwingFactorial(std::uint64_t n, unsigned threads = std::thread::hardware_concurrency());
+
+        /**
+         * @brief Calculates n! mod m without big numbers. n! mod m = 0 if n >= m. For prime 'm' and n >= m / 2
+         * Wilson's theorem (m - 1)! = -1 (mod m) is used, so only (m - 1 - n) multiplications are needed.
+         * @throw std::domain_error if m = 0
+         */
+        std::uint64_t factorialMod(std::uint64_t n, std::uint64_t m);
+    }
+
+    namespace time
+    {
+        /**
+         * @brief A high-resolution timer for measuring elapsed time.
+         * The Timer class provides functionality to measure the elapsed time between
+         * starting and stopping the timer. It uses the steady clock, so it isn't affected by changes of the system time.
+         */
+        class Timer
+        {
+        private:
+            std::chrono::steady_clock::time_point m_start_tp, m_end_tp;
+            bool m_isstarted{false};
+
+        public:
+            /// @brief Defaulted ctor
+            explicit Timer() = default;
+
+            /**
+             * @brief Starts the timer.
+             * Marks the starting point of the timer by recording the current time.
+             */
+            void startTimer()
+            {
+                m_isstarted = true;
+                m_start_tp = std::chrono::steady_clock::now();
+            }
+
+            /**
+             * @brief Stops the timer.
+             * Marks the ending point of the timer by recording the current time.
+             */
+            void stopTimer()
+            {
+                m_isstarted = false;
+                m_end_tp = std::chrono::steady_clock::now();
+            }
+
+            /**
+             * @brief Gets the elapsed time in milliseconds.
+             * Calculates and returns the elapsed time in milliseconds between the start and stop points.
+             * It is necessary to stop the timer before calling this function.
+             * @return Elapsed time in milliseconds
+             */
+            unsigned elaplsedTimeMS() const
+            {
+                assert(!m_isstarted);
+                auto elapsed{m_end_tp - m_start_tp};
+                auto ms{std::chrono::duration_cast<std::chrono::milliseconds>(elapsed)};
+                return ms.count();
+            }
+
+            /// @brief Elapsed time with the resolution of the clock, timer must be stopped
+            std::chrono::nanoseconds elapsed() const
+            {
+                assert(!m_isstarted);
+                return std::chrono::duration_cast<std::chrono::nanoseconds>(m_end_tp - m_start_tp);
+            }
+        };
+
+        /**
+         * @brief Measures the execution time of a callable function with the provided arguments.
+         * This function executes the given callable object and measures the elapsed time
+         * between the start and stop points using a Timer. The result is the elapsed time
+         * in milliseconds.
+         * @tparam Callable Type of the callable object (function, lambda, etc.)
+         * @tparam Args Parameter types for the callable object
+         * @param callable The callable object to be measured
+         * @param args Arguments to be forwarded to the callable object
+         * @return Elapsed time in milliseconds
+         * @note Single run in whole milliseconds, use 'benchmark::measure()' for the repeatable measurements
+         */
+        template <typename Callable, typename... Args>
+        unsigned int measureExecutionTime(Callable &&callable, Args &&...args)
+        {
+            static_assert(std::is_invocable_v<Callable, Args...>, "Callable must be invocable with Args");
+
+            Timer timer;
+            timer.startTimer();
+            std::invoke(std::forward<Callable>(callable), std::forward<Args>(args)...);
+            timer.stopTimer();
+            return timer.elaplsedTimeMS();
+        }
+
+        /**
+         * @brief Low-overhead timer counting ticks of the time-stamp counter (rdtsc) on x86, on the other
+         * architectures ticks are nanoseconds of the steady clock. Ticks are converted to time by the
+         * frequency calibrated once against the steady clock. Timer accumulates time of all start/stop
+         * intervals and can measure laps inside them.
+         * @note TSC is expected to be invariant (constant rate, synchronized between cores), it is on all
+         * x86-64 processors of the last decade.
+         */
+        class CycleTimer
+        {
+        private:
+            std::uint64_t m_start{}, m_lapStart{}, m_total{}, m_laps{};
+            bool m_running{false};
+
+        public:
+            /// @brief Current value of the counter
+            static std::uint64_t now() noexcept
+            {
+#if defined(__x86_64__) || defined(__i386__)
+                return __rdtsc();
+#else
+                return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+            }
+
+            /// @brief Current value of the counter that is read after all previous instructions are completed (rdtscp)
+            static std::uint64_t nowSerialized() noexcept
+            {
+#if defined(__x86_64__) || defined(__i386__)
+                unsigned aux;
+                return __rdtscp(&aux);
+#else
+                return now();
+#endif
+            }
+
+            /// @brief Count of ticks per nanosecond (calibrated at the first call, takes ~10 ms)
+            static double ticksPerNanosecond();
+
+            static std::chrono::nanoseconds toDuration(std::uint64_t ticks)
+            {
+                return std::chrono::nanoseconds(static_cast<std::int64_t>(static_cast<double>(ticks) / ticksPerNanosecond()));
+            }
+
+            void start() noexcept
+            {
+                m_running = true;
+                m_start = m_lapStart = now();
+            }
+
+            /// @brief Stops the timer and adds the interval to the accumulated time
+            void stop() noexcept
+            {
+                if (!m_running)
+                    return;
+                m_total += nowSerialized() - m_start;
+                m_running = false;
+            }
+
+            /// @brief Returns ticks since the previous lap (or start) and starts the new lap
+            std::uint64_t lap() noexcept
+            {
+                std::uint64_t const t{nowSerialized()};
+                std::uint64_t const res{t - m_lapStart};
+                m_lapStart = t;
+                ++m_laps;
+                return res;
+            }
+
+            void reset() noexcept { *this = CycleTimer(); }
+
+            /// @brief Accumulated ticks including the current interval if the timer is running
+            std::uint64_t ticks() const noexcept { return m_total + (m_running ? nowSerialized() - m_start : 0ull); }
+            std::chrono::nanoseconds elapsed() const { return toDuration(ticks()); }
+            std::uint64_t laps() const noexcept { return m_laps; }
+        };
+
+        /// @brief Records the zone with static lifetime 'name' to the ring buffer of the current thread
+        void recordZone(char const *name, std::uint64_t startTicks, std::uint64_t endTicks) noexcept;
+
+        /**
+         * @brief Writes zones recorded by all threads in Chrome trace event format (JSON),
+         * it can be opened by chrome://tracing or Perfetto. Every thread keeps only the last
+         * 'kZoneBufferCapacity' zones. Zones that are being overwritten during export are skipped.
+         */
+        void exportChromeTrace(std::ostream &os);
+
+        /// @brief Forgets all zones recorded before the call
+        void clearZones();
+
+        inline constexpr size_t kZoneBufferCapacity{1ul << 16ul};
+
+        /**
+         * @brief RAII profiling zone: time between construction and destruction is recorded to the
+         * lock-free ring buffer of the current thread (see 'exportChromeTrace()').
+         * Name must outlive the export, i.e. string literal:
+         * void hotFunction() { lvt::time::ScopedZone const zone("hotFunction"); ... }
+         */
+        class ScopedZone
+        {
+        private:
+            char const *m_name;
+            std::uint64_t m_start;
+
+        public:
+            explicit ScopedZone(char const *name) noexcept : m_name(name), m_start(CycleTimer::now()) {}
+            ~ScopedZone() { recordZone(m_name, m_start, CycleTimer::now()); }
+
+            ScopedZone(ScopedZone const &) = delete;
+            ScopedZone &operator=(ScopedZone const &) = delete;
+        };
+
+        // Printing current time to terminal at specified format
+        void printCurTime(const StringConvertible auto &);
+
+        // Printing duration of executing some code snippet
+        // At first, where do you want to start the timer, you need to write following line:
+        // auto start{std::chrono::high_resolution_clock::now()};
+        // and then execute this func
+        void printExecutionTime(const auto &);
+
+        /**
+         * @brief Converts string to a formatted time (check 'time_t_to_str()' function)
+         * @param str string to convert to the time format
+         * @param format format in which will be time represented
+         * @return "time_t" time
+         */
+        std::time_t str_to_time_t(std::string const &str, const char *format);
+
+        /**
+         * @brief Converts "time_t" variable to a string (check 'str_to_time_t()' function)
+         * @param time time that will be converted
+         * @param format format in which will be time represented
+         * @return Converted time
+         */
+        std::string time_t_to_str(std::time_t const &time, char const *format);
+
+        /// @brief Generates random valid date of birth with age in interval [18; 100] (by default)
+        /// @param lowestAge lowest age of a person - by default is 18
+        /// @param highestAge highest age of a person - by default is 100
+        /// @return Date of birth represented as a string with format: "dd/mm/yyyy"
+        std::string generateRandomDateOfBirth(int lowestAge = 18, int highestAge = 100);
+
+        /// @brief Returns uniformly distributed valid date from [from; to]
+        template <std::uniform_random_bit_generator Engine>
+        std::chrono::year_month_day randomDate(std::chrono::sys_days from, std::chrono::sys_days to, Engine &engine)
+        {
+            if (from > to)
+                throw std::invalid_argument("time::randomDate(): interval of dates is empty");
+            return std::chrono::year_month_day(from + std::chrono::days(random::uniform<std::int64_t>(0, (to - from).count(), engine)));
+        }
+
+        /**
+         * @brief Returns uniformly distributed date of birth of the person whose age on the 'today' date is
+         * in [lowestAge; highestAge]. Every returned date is valid (including February 29 of leap years).
+         * @throw std::invalid_argument if lowestAge > highestAge or ages are negative
+         */
+        template <std::uniform_random_bit_generator Engine>
+        std::chrono::year_month_day randomDateOfBirth(int lowestAge, int highestAge, std::chrono::sys_days today, Engine &engine)
+        {
+            using namespace std::chrono;
+            if (lowestAge < 0 || lowestAge > highestAge)
+                throw std::invalid_argument("time::randomDateOfBirth(): wrong interval of ages");
+
+            // Date minus whole years, February 29 becomes February 28 in the non-leap year
+            auto const yearsBefore{[ymd = year_month_day(today)](int count)
+                                   {
+                                       year_month_day const res{ymd - years(count)};
+                                       return res.ok() ? sys_days(res) : sys_days(res.year() / res.month() / last);
+                                   }};
+
+            // Age is 'highestAge' for the next day after 'highestAge' + 1 years ago
+            return randomDate(yearsBefore(highestAge + 1) + days(1), yearsBefore(lowestAge), engine);
+        }
+
+        /// @brief Writes date as "dd/mm/yyyy" to the caller's buffer of 10 chars without allocations
+        constexpr void formatDate(std::span<char, 10ul> out, std::chrono::year_month_day const &date) noexcept
+        {
+            unsigned const day{static_cast<unsigned>(date.day())}, month{static_cast<unsigned>(date.month())};
+            int const year{static_cast<int>(date.year())};
+            unsigned const yearAbs{static_cast<unsigned>(year < 0 ? -year : year) % 10000u};
+            out[0] = static_cast<char>('0' + day / 10u);
+            out[1] = static_cast<char>('0' + day % 10u);
+            out[2] = '/';
+            out[3] = static_cast<char>('0' + month / 10u);
+            out[4] = static_cast<char>('0' + month % 10u);
+            out[5] = '/';
+            out[6] = static_cast<char>('0' + yearAbs / 1000u);
+            out[7] = static_cast<char>('0' + yearAbs / 100u % 10u);
+            out[8] = static_cast<char>('0' + yearAbs / 10u % 10u);
+            out[9] = static_cast<char>('0' + yearAbs % 10u);
+        }
+    }
+
+    namespace benchmark
+    {
+        /// @brief Forces the compiler to materialize 'value' (i.e. result of the measured code isn't thrown away)
+        template <typename T>
+        inline void doNotOptimize(T const &value)
+        {
+            asm volatile("" : : "r,m"(value) : "memory");
+        }
+
+        /// @brief Forces the compiler to materialize 'value' and to assume that it's modified
+        template <typename T>
+        inline void doNotOptimize(T &value)
+        {
+#if defined(__clang__)
+            asm volatile("" : "+r,m"(value) : : "memory");
+#else
+            asm volatile("" : "+m,r"(value) : : "memory");
+#endif
+        }
+
+        /// @brief Forces all pending writes to memory to be done (compiler barrier, not a CPU fence)
+        inline void clobberMemory() { asm volatile("" : : : "memory"); }
+
+        /// @brief Hardware and software events counted by 'PerfCounters'
+        enum class PerfEvent : std::uint8_t
+        {
+            Cycles,
+            Instructions,
+            CacheReferences,
+            CacheMisses,
+            BranchMisses,
+            PageFaults,
+            Count
+        };
+
+        /// @brief Values of the counters, only events from 'available' mask were counted
+        struct CounterValues
+        {
+            std::array<std::uint64_t, static_cast<size_t>(PerfEvent::Count)> values{};
+            std::uint32_t available{}; // Bit mask of the counted 'PerfEvent's
+
+            bool has(PerfEvent event) const noexcept { return (available >> static_cast<unsigned>(event)) & 1u; }
+            std::uint64_t operator[](PerfEvent event) const noexcept { return values[static_cast<size_t>(event)]; }
+
+            /// @brief Instructions per cycle, NaN if any of them isn't counted
+            double ipc() const noexcept
+            {
+                if (!has(PerfEvent::Cycles) || !has(PerfEvent::Instructions) || (*this)[PerfEvent::Cycles] == 0ull)
+                    return std::numeric_limits<double>::quiet_NaN();
+                return static_cast<double>((*this)[PerfEvent::Instructions]) / static_cast<double>((*this)[PerfEvent::Cycles]);
+            }
+
+            /// @brief Count of the event per item ('items' of the loop), NaN if the event isn't counted
+            double per(PerfEvent event, std::uint64_t items) const noexcept
+            {
+                if (!has(event) || items == 0ull)
+                    return std::numeric_limits<double>::quiet_NaN();
+                return static_cast<double>((*this)[event]) / static_cast<double>(items);
+            }
+
+            CounterValues &operator+=(CounterValues const &other) noexcept
+            {
+                for (size_t i{}; i < values.size(); ++i)
+                    values[i] += other.values[i];
+                available = (available == 0u) ? other.available : (available & other.available);
+                return *this;
+            }
+        };
+
+        /**
+         * @brief Group of the counters opened by perf_event_open(2) for the calling thread (user space only).
+         * Events that aren't supported or permitted (i.e. in virtual machines or with restrictive
+         * 'perf_event_paranoid') are skipped, if none of them is available all calls do nothing
+         * and return values with the empty 'available' mask. Values are scaled if counters are multiplexed.
+         */
+        class PerfCounters
+        {
+        private:
+            std::array<int, static_cast<size_t>(PerfEvent::Count)> m_fds;
+            std::array<std::uint64_t, static_cast<size_t>(PerfEvent::Count)> m_ids{}; // To match values of the group read
+            int m_leader{-1};
+
+        public:
+            PerfCounters();
+            ~PerfCounters();
+
+            PerfCounters(PerfCounters const &) = delete;
+            PerfCounters &operator=(PerfCounters const &) = delete;
+
+            bool available() const noexcept { return m_leader != -1; }
+
+            /// @brief Resets and starts the counters
+            void start() noexcept;
+
+            /// @brief Stops the counters and returns their values since 'start()'
+            CounterValues stop() noexcept;
+        };
+
+        /// @brief Counts events (see 'PerfCounters') during the lifetime of the object and adds them to 'out'
+        class ScopedCounters
+        {
+        private:
+            PerfCounters &m_counters;
+            CounterValues &m_out;
+
+        public:
+            ScopedCounters(PerfCounters &counters, CounterValues &out) noexcept : m_counters(counters), m_out(out) { m_counters.start(); }
+            ~ScopedCounters() { m_out += m_counters.stop(); }
+
+            ScopedCounters(ScopedCounters const &) = delete;
+            ScopedCounters &operator=(ScopedCounters const &) = delete;
+        };
+
+        /// @brief Calls 'callable' and returns counted events
+        template <typename Callable>
+        CounterValues countEvents(Callable &&callable)
+        {
+            PerfCounters counters;
+            CounterValues values;
+            {
+                ScopedCounters const scope(counters, values);
+                std::invoke(std::forward<Callable>(callable));
+            }
+            return values;
+        }
+
+        /// @brief Allocations made through the global 'operator new' (or 'CountingResource')
+        struct AllocationStats
+        {
+            std::uint64_t allocations{}, deallocations{};
+            std::uint64_t allocatedBytes{}, freedBytes{};
+            std::uint64_t peakBytes{}; // Maximum of live bytes over the scope (relatively to its beginning)
+
+            std::int64_t liveBytes() const noexcept { return static_cast<std::int64_t>(allocatedBytes - freedBytes); }
+
+            AllocationStats &operator+=(AllocationStats const &other) noexcept
+            {
+                allocations += other.allocations;
+                deallocations += other.deallocations;
+                allocatedBytes += other.allocatedBytes;
+                freedBytes += other.freedBytes;
+                peakBytes = std::max(peakBytes, other.peakBytes);
+                return *this;
+            }
+        };
+
+        /**
+         * @brief "true" if the library is built with 'LVT_TRACK_ALLOCATIONS' defined (CMake option of the same name):
+         * then it replaces global 'operator new'/'operator delete', and allocations of the thread are counted while
+         * there is an 'AllocationScope' on it (otherwise the overhead is a single check of the thread-local counter).
+         * Sizes are the usable sizes of the blocks (malloc_usable_size(3)).
+         */
+        bool allocationTrackingEnabled() noexcept;
+
+        /**
+         * @brief Counts allocations of the current thread during the lifetime of the guard, guards can be nested.
+         * Without 'allocationTrackingEnabled()' nothing is counted. The "zero-allocation" path can be checked as:
+         * lvt::benchmark::AllocationScope const scope;
+         * hotPath();
+         * assert(lvt::benchmark::allocationTrackingEnabled() && scope.stats().allocations == 0);
+         */
+        class AllocationScope
+        {
+        private:
+            AllocationStats m_start;
+            std::int64_t m_startLive, m_outerPeak;
+
+        public:
+            AllocationScope() noexcept;
+            ~AllocationScope();
+
+            AllocationScope(AllocationScope const &) = delete;
+            AllocationScope &operator=(AllocationScope const &) = delete;
+
+            /// @brief Allocations since the construction of the guard
+            AllocationStats stats() const noexcept;
+        };
+
+        /**
+         * @brief Calls 'callable' and returns its allocations
+         * @throw std::logic_error if allocations aren't tracked (see 'allocationTrackingEnabled()')
+         */
+        template <typename Callable>
+        AllocationStats countAllocations(Callable &&callable)
+        {
+            if (!allocationTrackingEnabled())
+                throw std::logic_error("countAllocations(): library is built without LVT_TRACK_ALLOCATIONS");
+            AllocationScope const scope;
+            std::invoke(std::forward<Callable>(callable));
+            return scope.stats();
+        }
+
+        /// @brief Memory resource that counts allocations passed to 'upstream', doesn't require replaced 'operator new'
+        class CountingResource : public std::pmr::memory_resource
+        {
+        private:
+            std::pmr::memory_resource *m_upstream;
+            AllocationStats m_stats;
+
+            void *do_allocate(size_t bytes, size_t alignment) override
+            {
+                void *p{m_upstream->allocate(bytes, alignment)};
+                ++m_stats.allocations;
+                m_stats.allocatedBytes += bytes;
+                m_stats.peakBytes = std::max(m_stats.peakBytes, static_cast<std::uint64_t>(m_stats.liveBytes()));
+                return p;
+            }
+
+            void do_deallocate(void *p, size_t bytes, size_t alignment) override
+            {
+                m_upstream->deallocate(p, bytes, alignment);
+                ++m_stats.deallocations;
+                m_stats.freedBytes += bytes;
+            }
+
+            bool do_is_equal(std::pmr::memory_resource const &other) const noexcept override { return this == &other; }
+
+        public:
+            explicit CountingResource(std::pmr::memory_resource *upstream = std::pmr::get_default_resource()) noexcept
+                : m_upstream(upstream) {}
+
+            AllocationStats const &stats() const noexcept { return m_stats; }
+            void reset() noexcept { m_stats = {}; }
+        };
+
+        /**
+         * @brief State of the single run of the benchmark: argument of the sweep and count of iterations.
+         * Time is measured only inside the loop, setup before it isn't taken into account:
+         *
+         * void sortBench(lvt::benchmark::State &state)
+         * {
+         *     auto v{generateRandomVector<int>(state.arg(), 0, 100)};
+         *     for (auto _ : state)
+         *     {
+         *         auto copy{v};
+         *         std::sort(copy.begin(), copy.end());
+         *         lvt::benchmark::doNotOptimize(copy.data());
+         *     }
+         * }
+         * LVT_BENCHMARK(sortBench, 1'000, 100'000);
+         */
+        class State
+        {
+        private:
+            using clock = std::chrono::steady_clock;
+
+            std::uint64_t m_iterations;
+            std::int64_t m_arg;
+            clock::time_point m_start, m_end;
+            std::uint64_t m_items{1ull};
+            PerfCounters *m_counters{};
+            CounterValues m_counted;
+            bool m_trackAllocations{false};
+            std::optional<AllocationScope> m_allocationScope;
+            AllocationStats m_allocated;
+
+        public:
+            // Type of the loop variable, attribute suppresses warning about unused variable
+            struct [[maybe_unused]] Iteration
+            {
+            };
+
+            class iterator
+            {
+            private:
+                State *m_state;
+                std::uint64_t m_remaining;
+
+            public:
+                iterator(State *state, std::uint64_t remaining) : m_state(state), m_remaining(remaining) {}
+
+                Iteration operator*() const noexcept { return {}; }
+                iterator &operator++() noexcept
+                {
+                    --m_remaining;
+                    return *this;
+                }
+
+                // Timer is stopped right when the loop is finished
+                bool operator!=(std::default_sentinel_t) noexcept
+                {
+                    if (m_remaining != 0ull) [[likely]]
+                        return true;
+                    m_state->m_end = clock::now();
+                    if (m_state->m_counters)
+                        m_state->m_counted += m_state->m_counters->stop();
+                    if (m_state->m_allocationScope)
+                    {
+                        m_state->m_allocated += m_state->m_allocationScope->stats();
+                        m_state->m_allocationScope.reset();
+                    }
+                    return false;
+                }
+            };
+
+            State(std::uint64_t iterations, std::int64_t arg, PerfCounters *counters = nullptr, bool trackAllocations = false) noexcept
+                : m_iterations(iterations), m_arg(arg), m_counters(counters), m_trackAllocations(trackAllocations) {}
+
+            iterator begin() noexcept
+            {
+                if (m_trackAllocations)
+                    m_allocationScope.emplace();
+                if (m_counters)
+                    m_counters->start();
+                m_start = clock::now();
+                return iterator(this, m_iterations);
+            }
+            std::default_sentinel_t end() const noexcept { return {}; }
+
+            std::int64_t arg() const noexcept { return m_arg; }
+            std::uint64_t iterations() const noexcept { return m_iterations; }
+            std::chrono::nanoseconds elapsed() const noexcept { return m_end - m_start; }
+
+            /// @brief Count of the processed items (i.e. elements) per iteration, counters are reported per item
+            void setItemsPerIteration(std::uint64_t items) noexcept { m_items = std::max<std::uint64_t>(items, 1ull); }
+            std::uint64_t itemsPerIteration() const noexcept { return m_items; }
+
+            /// @brief Events counted inside the loop (if counters are enabled)
+            CounterValues const &counted() const noexcept { return m_counted; }
+
+            /// @brief Allocations made inside the loop (if their tracking is enabled)
+            AllocationStats const &allocated() const noexcept { return m_allocated; }
+        };
+
+        struct Options
+        {
+            std::chrono::nanoseconds minSampleTime{std::chrono::milliseconds(5)}; // Iterations are calibrated to it
+            std::chrono::nanoseconds warmupTime{std::chrono::milliseconds(50)};
+            size_t samples{25ul};
+            double outlierThreshold{3.5}; // Samples farther than this count of scaled MADs from the median are outliers
+            bool perfCounters{false};     // Count hardware events of the samples (see 'PerfCounters')
+            bool trackAllocations{false}; // Count allocations of the samples (see 'allocationTrackingEnabled()')
+        };
+
+        /// @brief Statistics of the time of one iteration in nanoseconds, outliers are excluded (except of 'min'/'max')
+        struct Statistics
+        {
+            std::uint64_t iterationsPerSample{};
+            size_t samples{};
+            size_t outliers{};
+            double min{}, max{}, mean{}, stddev{};
+            double median{}, mad{}; // MAD is scaled by 1.4826 to be comparable with standard deviation
+            double p10{}, p90{}, p99{};
+
+            // Events of all the samples (if 'Options::perfCounters' is set), 'countedItems' is the divisor for them
+            std::optional<CounterValues> counters;
+            std::uint64_t countedItems{};
+
+            // Allocations of all the samples (if 'Options::trackAllocations' is set) made by 'countedIterations'
+            std::optional<AllocationStats> allocations;
+            std::uint64_t countedIterations{};
+        };
+
+        /// @brief Calculates statistics of the per-iteration times (nanoseconds) with outliers rejection
+        Statistics computeStatistics(std::vector<double> samples, std::uint64_t iterationsPerSample, double outlierThreshold);
+
+        /**
+         * @brief Runs 'fn(State &)': grows count of iterations until one run takes at least 'options.minSampleTime'
+         * (by the factor predicted from the last run with a margin, clamped to 2-10 times), warms up and then
+         * collects 'options.samples' samples
+         */
+        Statistics run(std::function<void(State &)> const &fn, std::int64_t arg = 0, Options const &options = {});
+
+        /// @brief Measures nullary callable, its result is passed to 'doNotOptimize()'
+        template <typename Callable>
+        Statistics measure(Callable &&callable, Options const &options = {})
+        {
+            return run([&callable](State &state)
+                       {
+                           for ([[maybe_unused]] auto _ : state)
+                           {
+                               if constexpr (std::is_void_v<std::invoke_result_t<Callable &>>)
+                                   std::invoke(callable);
+                               else
+                                   doNotOptimize(std::invoke(callable));
+                           } },
+                       0, options);
+        }
+
+        struct Result
+        {
+            std::string name;
+            std::int64_t arg{};
+            Statistics stats;
+        };
+
+        /// @brief Adds benchmark to the global registry, it's run for every argument (or once with 0 if there are none)
+        bool registerBenchmark(std::string name, std::function<void(State &)> fn, std::vector<std::int64_t> args = {});
+
+        /// @brief Geometric sequence of the arguments for sweeps: lo, lo * multiplier, ..., and 'hi'
+        std::vector<std::int64_t> range(std::int64_t lo, std::int64_t hi, std::int64_t multiplier = 8);
+
+        /// @brief Runs registered benchmarks whose names contain 'filter'
+        std::vector<Result> runRegistered(std::string_view filter = {}, Options const &options = {});
+
+        void writeJson(std::ostream &os, std::span<Result const> results);
+        void writeCsv(std::ostream &os, std::span<Result const> results);
+    }
+
+    namespace logging
+    {
+        enum class Level : std::uint8_t
+        {
+            Trace,
+            Debug,
+            Info,
+            Warning,
+            Error,
+            Off
+        };
+
+        /// @brief Name of the level as it's written to the log
+        std::string_view toString(Level level) noexcept;
+
+        /// @brief "false" if messages of the level are removed at compile time (see 'LVT_LOG_ACTIVE_LEVEL')
+        constexpr bool isCompiledIn(Level level) noexcept { return static_cast<int>(level) + 1 > LVT_LOG_ACTIVE_LEVEL; }
+
+        /**
+         * @brief Destination of the formatted lines, it's called only from the backend thread of the logger.
+         * Exceptions thrown by 'write()' and 'flush()' are caught, their count is reported to the sinks as an error.
+         * Messages logged by the sink itself are dropped.
+         */
+        class Sink
+        {
+        public:
+            virtual ~Sink() = default;
+
+            /// @param line formatted message with trailing '\n'
+            virtual void write(Level level, std::string_view line) = 0;
+
+            /// @brief Called after every batch of the messages
+            virtual void flush() {}
+        };
+
+        class StreamSink : public Sink
+        {
+        private:
+            std::ostream &m_os;
+
+        public:
+            explicit StreamSink(std::ostream &os = std::clog) : m_os(os) {}
+
+            void write(Level, std::string_view line) override { m_os.write(line.data(), static_cast<std::streamsize>(line.size())); }
+            void flush() override { m_os.flush(); }
+        };
 
         /**
-         * @brief Comparator for the map
-         * @tparam Map template parameter that defines map
-         * @param lhs first map
-         * @param rhs second map
-         * @return `true` if sizes and contents of the both maps are equal, otherwise `false`.
+         * @brief Appends lines to the file. When the size of the file would exceed 'maxBytes', files are shifted:
+         * "<path>.1" becomes "<path>.2" and so on (the oldest one is removed), "<path>" becomes "<path>.1"
+         * and the new "<path>" is started (if it can't be opened, lines go to the old file until the next rotation).
+         * Lines are buffered and written by the single call per batch.
          */
-        template <typename Map>
-        constexpr bool map_compare(Map const &lhs, Map const &rhs);
-    }
+        class RotatingFileSink : public Sink
+        {
+        private:
+            std::filesystem::path m_path;
+            size_t m_maxBytes, m_maxFiles;
+            size_t m_size{}; // Size of the file including buffered lines
+            int m_fd{-1};
+            std::string m_buffer;
 
-    namespace big_numbers
-    {
-        // Calculates sum of 2 big numbers represented as array of integer
-        void sum(const std::vector<int> &, const std::vector<int> &, std::vector<int> &);
+            void open();
+            void rotate();
+            void writeBuffer() noexcept;
 
-        // Calculates product of 2 big numbers represented as array of integer
-        void product(const std::vector<int> &, const std::vector<int> &, std::vector<int> &);
+        public:
+            /// @throw std::system_error if file can't be opened
+            explicit RotatingFileSink(std::filesystem::path path, size_t maxBytes = 10ul << 20ul, size_t maxFiles = 5ul);
+            ~RotatingFileSink() override;
 
-        // Returns factorial of number
-        std::string factorial(int);
+            RotatingFileSink(RotatingFileSink const &) = delete;
+            RotatingFileSink &operator=(RotatingFileSink const &) = delete;
+
+            void write(Level level, std::string_view line) override;
+            void flush() override;
+        };
+
+        /// @brief Allows at most 'perSecond' events per second, can be used concurrently (then it's approximate)
+        class RateLimiter
+        {
+        private:
+            std::atomic<std::uint64_t> m_windowTicks{}; // 0 until the first window is over
+            std::uint32_t m_perSecond;
+            std::atomic<std::uint64_t> m_windowStart;
+            std::atomic<std::uint32_t> m_count{};
+            std::atomic<std::uint64_t> m_suppressed{};
+            std::chrono::steady_clock::time_point m_firstWindowStart;
+
+            bool firstWindowElapsed(std::uint64_t now, std::uint64_t start) noexcept;
+
+            bool windowElapsed(std::uint64_t now, std::uint64_t start) noexcept
+            {
+                if (std::uint64_t const window{m_windowTicks.load(std::memory_order_relaxed)}; window != 0ull) [[likely]]
+                    return now - start >= window;
+                return firstWindowElapsed(now, start);
+            }
+
+        public:
+            explicit RateLimiter(std::uint32_t perSecond);
+
+            bool allow() noexcept
+            {
+                std::uint64_t const now{time::CycleTimer::now()};
+                std::uint64_t start{m_windowStart.load(std::memory_order_relaxed)};
+                if (windowElapsed(now, start) && m_windowStart.compare_exchange_strong(start, now, std::memory_order_relaxed))
+                    m_count.store(0u, std::memory_order_relaxed);
+                if (m_count.fetch_add(1u, std::memory_order_relaxed) < m_perSecond)
+                    return true;
+                m_suppressed.fetch_add(1ull, std::memory_order_relaxed);
+                return false;
+            }
+
+            /// @brief Count of the rejected events
+            std::uint64_t suppressed() const noexcept { return m_suppressed.load(std::memory_order_relaxed); }
+        };
+
+        namespace detail
+        {
+            using FormatFn = void (*)(std::string &out, std::string_view fmt, std::byte const *args);
+
+            struct RecordHeader
+            {
+                FormatFn format;
+                char const *fmt;
+                size_t fmtSize;
+                std::source_location location;
+                std::uint64_t ticks;
+                Level level;
+            };
+
+            // Strings are copied to the queue, other arguments are copied by bytes
+            template <typename T>
+            concept StringLike = std::convertible_to<T const &, std::string_view>;
+
+            template <typename T>
+            using stored_t = std::conditional_t<StringLike<T>, std::string_view, T>;
+
+            template <typename T>
+            size_t argSize(T const &arg) noexcept
+            {
+                if constexpr (StringLike<T>)
+                    return sizeof(size_t) + std::string_view(arg).size();
+                else
+                {
+                    static_assert(std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>,
+                                  "Arguments of the log message must be strings or trivially copyable values");
+                    return sizeof(T);
+                }
+            }
+
+            template <typename T>
+            std::byte *writeArg(std::byte *p, T const &arg) noexcept
+            {
+                if constexpr (StringLike<T>)
+                {
+                    std::string_view const s(arg);
+                    size_t const size{s.size()};
+                    std::memcpy(p, &size, sizeof(size));
+                    std::memcpy(p + sizeof(size), s.data(), size);
+                    return p + sizeof(size) + size;
+                }
+                else
+                {
+                    std::memcpy(p, std::addressof(arg), sizeof(T));
+                    return p + sizeof(T);
+                }
+            }
+
+            template <typename T>
+            std::byte const *readArg(std::byte const *p, T &arg) noexcept
+            {
+                if constexpr (std::is_same_v<T, std::string_view>)
+                {
+                    size_t size;
+                    std::memcpy(&size, p, sizeof(size));
+                    arg = std::string_view(reinterpret_cast<char const *>(p + sizeof(size)), size);
+                    return p + sizeof(size) + size;
+                }
+                else
+                {
+                    std::memcpy(std::addressof(arg), p, sizeof(T));
+                    return p + sizeof(T);
+                }
+            }
+
+            /// @brief Restores arguments from the queue and formats them, it's called by the backend thread
+            template <typename... Args>
+            void formatRecord(std::string &out, std::string_view fmt, std::byte const *data)
+            {
+                std::tuple<stored_t<Args>...> args;
+                std::apply([&out, fmt, &data](auto &...arg)
+                           {
+                               ((data = readArg(data, arg)), ...);
+                               std::vformat_to(std::back_inserter(out), fmt, std::make_format_args(arg...)); },
+                           args);
+            }
+        }
+
+        /**
+         * @brief Asynchronous logger. Caller copies arguments of the message as bytes to the lock-free
+         * single-producer single-consumer queue of its thread, formatting, timestamps and writing to the
+         * sinks are done by the backend thread. If the queue is full, message is dropped (and counted).
+         * Caller of the error message waits until it's written, so it isn't lost if the program is terminated
+         * right after. Other callers are never blocked. By default messages are written to 'std::clog'.
+         * Use it by the macros: LVT_LOG_INFO("processed {} of {}: {}", done, total, name);
+         */
+        class Logger
+        {
+        private:
+            struct Impl;
+            std::unique_ptr<Impl> m_impl;
+            std::atomic<Level> m_level{Level::Info};
+
+            Logger();
+
+            // Reserves 'size' bytes in the queue of the current thread, nullptr if the queue is full
+            std::byte *reserve(size_t size) noexcept;
+            void commit() noexcept;
+
+            // 'flush()' for the error messages, does nothing on the backend thread
+            void waitWritten() noexcept;
+
+        public:
+            /// @brief Size of the queue of every thread in bytes
+            static constexpr size_t kQueueCapacity{1ul << 20ul};
+
+            static Logger &instance();
+            ~Logger();
+
+            Logger(Logger const &) = delete;
+            Logger &operator=(Logger const &) = delete;
+
+            /// @brief Runtime filter, messages with lower level are skipped by the caller
+            void setLevel(Level level) noexcept { m_level.store(level, std::memory_order_relaxed); }
+            Level level() const noexcept { return m_level.load(std::memory_order_relaxed); }
+            bool enabled(Level level) const noexcept { return level >= m_level.load(std::memory_order_relaxed); }
+
+            /// @brief Adds destination of the messages, the first call replaces the default 'std::clog' sink
+            void addSink(std::unique_ptr<Sink> sink);
+
+            /// @brief Waits until all messages logged before the call are written and sinks are flushed (returns
+            /// at once when it's called by a sink)
+            void flush();
+
+            /// @brief Count of the messages dropped because of the full queues
+            std::uint64_t dropped() const;
+
+            template <typename... Args>
+            void log(Level level, std::source_location location, std::format_string<Args...> fmt, Args &&...args) noexcept
+            {
+                if (!enabled(level))
+                    return;
+
+                size_t const size{sizeof(detail::RecordHeader) + (detail::argSize(args) + ... + 0ul)};
+                std::byte *p{reserve(size)};
+                if (!p)
+                    return;
+
+                detail::RecordHeader const header{&detail::formatRecord<std::remove_cvref_t<Args>...>, fmt.get().data(),
+                                                  fmt.get().size(), location, time::CycleTimer::now(), level};
+                std::memcpy(p, &header, sizeof(header));
+                p += sizeof(header);
+                ((p = detail::writeArg(p, args)), ...);
+                commit();
+                if (level >= Level::Error)
+                    waitWritten();
+            }
+        };
     }
 
-    namespace time
+    namespace files
     {
+        // Returns all content from a file as a "std::string"
+        // Buffer is sized once by the size of the file and filled by a single read, empty string on error
+        std::string readFileToStr(std::string const &);
+
         /**
-         * @brief A high-resolution timer for measuring elapsed time.
-         * The Timer class provides functionality to measure the elapsed time between
-         * starting and stopping the timer. It uses the high-resolution clock for precision.
+         * @brief Read-only memory mapping of the whole file with RAII unmapping.
+         * Content is accessed without copying, pages are loaded by the kernel on demand.
+         *
+         * Example of usage:
+         * MappedFile const file("data.csv");
+         * for (auto line : file.view() | std::views::split('\n'))
+         *     ...
          */
-        class Timer
+        class MappedFile
         {
+        public:
+            /// @brief Hint to the kernel how the mapping is going to be read (see madvise(2))
+            enum class Advice
+            {
+                Normal,
+                Sequential, ///< aggressive read-ahead, pages behind may be freed early
+                Random,     ///< no read-ahead
+                WillNeed    ///< start loading of the whole file in background
+            };
+
         private:
-            std::chrono::high_resolution_clock::time_point m_start_tp, m_end_tp;
-            bool m_isstarted{false};
+            void *m_data{};
+            size_t m_size{};
 
         public:
-            /// @brief Defaulted ctor
-            explicit Timer() = default;
+            MappedFile() noexcept = default;
 
             /**
-             * @brief Starts the timer.
-             * Marks the starting point of the timer by recording the current high-resolution time.
+             * @brief Maps the file. Transparent huge pages are requested where the kernel supports them for files.
+             * @param path path to the file
+             * @param advice expected access pattern
+             * @param populate "true" to prefault all pages at once instead of taking page faults while reading
+             * @throw std::system_error if file can't be opened or mapped
              */
-            void startTimer()
+            explicit MappedFile(std::filesystem::path const &path, Advice advice = Advice::Sequential, bool populate = false);
+
+            MappedFile(MappedFile const &) = delete;
+            MappedFile &operator=(MappedFile const &) = delete;
+            MappedFile(MappedFile &&other) noexcept
+                : m_data(std::exchange(other.m_data, nullptr)), m_size(std::exchange(other.m_size, 0ul)) {}
+            MappedFile &operator=(MappedFile &&other) noexcept
             {
-                m_isstarted = true;
-                m_start_tp = std::chrono::high_resolution_clock::now();
+                if (this != &other)
+                {
+                    close();
+                    m_data = std::exchange(other.m_data, nullptr);
+                    m_size = std::exchange(other.m_size, 0ul);
+                }
+                return *this;
             }
+            ~MappedFile() { close(); }
+
+            /// @brief Unmaps the file, all views of the content become dangling
+            void close() noexcept;
+
+            /// @brief Gives new hint for the part of the mapping [offset; offset + length)
+            void advise(Advice advice, size_t offset = 0ul, size_t length = std::numeric_limits<size_t>::max()) const noexcept;
+
+            char const *data() const noexcept { return static_cast<char const *>(m_data); }
+            size_t size() const noexcept { return m_size; }
+            bool empty() const noexcept { return m_size == 0ul; }
+
+            std::span<std::byte const> bytes() const noexcept { return std::span<std::byte const>(static_cast<std::byte const *>(m_data), m_size); }
+            std::string_view view() const noexcept { return std::string_view(data(), m_size); }
+        };
+
+        /**
+         * @brief Reads file by chunks of fixed size in constant memory. With read-ahead the next chunk is read
+         * by background thread (by pread(2)) while the current one is processed: there are two buffers,
+         * the one given to the caller and the one being filled.
+         */
+        class ChunkReader
+        {
+        private:
+            struct Impl;
+            std::unique_ptr<Impl> m_impl;
+
+        public:
+            static constexpr size_t kDefaultChunkSize{1ul << 20ul};
 
             /**
-             * @brief Stops the timer.
-             * Marks the ending point of the timer by recording the current high-resolution time.
+             * @param path path to the file
+             * @param chunkSize size of the chunks, the last one may be shorter
+             * @param readAhead "true" to read next chunk in background thread
+             * @throw std::system_error if file can't be opened
              */
-            void stopTimer()
-            {
-                m_isstarted = false;
-                m_end_tp = std::chrono::high_resolution_clock::now();
-            }
+            explicit ChunkReader(std::filesystem::path const &path, size_t chunkSize = kDefaultChunkSize, bool readAhead = true);
+            ChunkReader(ChunkReader &&) noexcept;
+            ChunkReader &operator=(ChunkReader &&) noexcept;
+            ~ChunkReader();
 
             /**
-             * @brief Gets the elapsed time in milliseconds.
-             * Calculates and returns the elapsed time in milliseconds between the start and stop points.
-             * It is necessary to stop the timer before calling this function.
-             * @return Elapsed time in milliseconds
+             * @brief Returns next chunk of the file, it's valid until the next call
+             * @return Chunk, empty at the end of the file
+             * @throw std::system_error on read error
              */
-            unsigned elaplsedTimeMS() const
-            {
-                assert(!m_isstarted);
-                auto elapsed{m_end_tp - m_start_tp};
-                auto ms{std::chrono::duration_cast<std::chrono::milliseconds>(elapsed)};
-                return ms.count();
-            }
+            std::string_view next();
         };
 
         /**
-         * @brief Measures the execution time of a callable function with the provided arguments.
-         * This function executes the given callable object and measures the elapsed time
-         * between the start and stop points using a Timer. The result is the elapsed time
-         * in milliseconds.
-         * @tparam Callable Type of the callable object (function, lambda, etc.)
-         * @tparam Args Parameter types for the callable object
-         * @param callable The callable object to be measured
-         * @param args Arguments to be forwarded to the callable object
-         * @return Elapsed time in milliseconds
+         * @brief Reads file line by line in constant memory (the longest line plus two chunks).
+         * Lines are views into the chunk (or into the internal buffer for lines crossing the border of chunks),
+         * so they are valid until the next call. Line doesn't contain '\n'.
+         *
+         * Example of usage:
+         * for (std::string_view line : LineReader("huge.log"))
+         *     if (line.starts_with("ERROR"))
+         *         ++errors;
          */
-        template <typename Callable, typename... Args>
-        unsigned int measureExecutionTime(Callable &&callable, Args &&...args)
+        class LineReader
         {
-            static_assert(std::is_invocable_v<Callable, Args...>, "Callable must be invocable with Args");
+        private:
+            ChunkReader m_reader;
+            std::string_view m_chunk; // Unprocessed part of the current chunk
+            std::string m_carry;      // Line that crosses the border of chunks
+            bool m_eof{false};
 
-            Timer timer;
-            timer.startTimer();
-            std::invoke(std::forward<Callable>(callable), std::forward<Args>(args)...);
-            timer.stopTimer();
-            return timer.elaplsedTimeMS();
-        }
+        public:
+            explicit LineReader(std::filesystem::path const &path, size_t chunkSize = ChunkReader::kDefaultChunkSize,
+                                bool readAhead = true)
+                : m_reader(path, chunkSize, readAhead) {}
 
-        // Printing current time to terminal at specified format
-        void printCurTime(const StringConvertible auto &);
+            /// @brief Returns next line or "std::nullopt" at the end of the file
+            std::optional<std::string_view> next();
 
-        // Printing duration of executing some code snippet
-        // At first, where do you want to start the timer, you need to write following line:
-        // auto start{std::chrono::high_resolution_clock::now()};
-        // and then execute this func
-        void printExecutionTime(const auto &);
+            class iterator
+            {
+            private:
+                LineReader *m_reader{};
+                std::string_view m_line;
+
+            public:
+                using value_type = std::string_view;
+                using difference_type = std::ptrdiff_t;
+
+                iterator() = default;
+                explicit iterator(LineReader &reader) : m_reader(&reader) { ++*this; }
+
+                std::string_view operator*() const noexcept { return m_line; }
+                iterator &operator++()
+                {
+                    if (auto const line{m_reader->next()})
+                        m_line = *line;
+                    else
+                        m_reader = nullptr;
+                    return *this;
+                }
+                void operator++(int) { ++*this; }
+                friend bool operator==(iterator const &it, std::default_sentinel_t) noexcept { return !it.m_reader; }
+            };
+
+            iterator begin() { return iterator(*this); }
+            std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+        };
+
+        /// @brief Calls 'fn' for every line of the file (see 'LineReader')
+        template <typename Fn>
+        void forEachLine(std::filesystem::path const &path, Fn fn)
+        {
+            for (std::string_view line : LineReader(path))
+                fn(line);
+        }
 
         /**
-         * @brief Converts string to a formatted time (check 'time_t_to_str()' function)
-         * @param str string to convert to the time format
-         * @param format format in which will be time represented
-         * @return "time_t" time
+         * @brief Streaming version of 'algorithm::split_str()': calls 'fn' for every word of every line,
+         * words are separated by any of 'delimiters', empty words are skipped
          */
-        std::time_t str_to_time_t(std::string const &str, const char *format);
+        template <typename Fn>
+        void forEachWord(std::filesystem::path const &path, Fn fn, std::string_view delimiters = " \t\r")
+        {
+            forEachLine(path, [&fn, delimiters](std::string_view line)
+                        {
+                            for (size_t pos{line.find_first_not_of(delimiters)}; pos != std::string_view::npos;)
+                            {
+                                size_t const end{std::min(line.find_first_of(delimiters, pos), line.size())};
+                                fn(line.substr(pos, end - pos));
+                                pos = line.find_first_not_of(delimiters, end);
+                            } });
+        }
 
         /**
-         * @brief Converts "time_t" variable to a string (check 'str_to_time_t()' function)
-         * @param time time that will be converted
-         * @param format format in which will be time represented
-         * @return Converted time
+         * @brief Streaming version of 'algorithm::regexFindAll()': calls 'fn' for every match in every line
+         * @param isMatch 0 for the whole matches, -1 for the parts between matches
          */
-        std::string time_t_to_str(std::time_t const &time, char const *format);
-
-        /// @brief Generates random date of birth with age in interval [18; 100] (by default)
-        /// @param lowestAge lowest age of a person - by default is 18
-        /// @param highestAge highest age of a person - by default is 100
-        /// @return Date of birth represented as a string with format: "dd/mm/yyyy"
-        std::string generateRandomDateOfBirth(int lowestAge = 18, int highestAge = 100);
-    }
+        void regexFindAll(std::filesystem::path const &path, std::string const &pattern,
+                          std::function<void(std::string_view)> const &fn, int isMatch = 0);
 
-    namespace files
-    {
-        // Returns all content from a file as a "std::string"
-        std::string readFileToStr(std::string const &);
+        /**
+         * @brief Streaming version of 'algorithm::calculateNGramFrequencies()': n-grams of the words of the file.
+         * Memory depends only on count of the distinct n-grams.
+         */
+        std::vector<std::pair<std::string, int>> calculateNGramFrequencies(std::filesystem::path const &path,
+                                                                           size_t lengthOfNGramm);
 
         // Returns size of the file as a "std::size_t"
         size_t getSizeOfTheFile(std::string const &);
@@ -953,6 +4919,65 @@ namespace lvt
         /// @return "true" if file exists, otherwise - "false"
         bool exists(std::string const &filename);
 
+        /// @brief Metadata of the file that is taken by the single statx(2) call
+        struct FileMetadata
+        {
+            std::uint64_t size{};
+            std::filesystem::file_type type{std::filesystem::file_type::unknown};
+            std::chrono::system_clock::time_point modified{};
+        };
+
+        /// @brief Metadata of the file (symbolic links are followed), "std::nullopt" if it doesn't exist or isn't accessible
+        std::optional<FileMetadata> metadata(std::filesystem::path const &path);
+
+        /**
+         * @brief Batched 'metadata()': paths are grouped by their directories, every directory is opened once
+         * and files are queried relatively to it by statx(2). Groups are distributed between 'threads' threads.
+         * @return Metadata in the order of 'paths'
+         */
+        std::vector<std::optional<FileMetadata>> metadata(std::span<std::filesystem::path const> paths,
+                                                          unsigned threads = std::thread::hardware_concurrency());
+
+        /// @brief Batched 'exists()', result[i] corresponds to paths[i]
+        std::vector<bool> exists(std::span<std::filesystem::path const> paths,
+                                 unsigned threads = std::thread::hardware_concurrency());
+
+        /// @brief Batched 'getSizeOfTheFile()', "std::nullopt" for missing files
+        std::vector<std::optional<std::uint64_t>> sizes(std::span<std::filesystem::path const> paths,
+                                                        unsigned threads = std::thread::hardware_concurrency());
+
+        /**
+         * @brief Thread-safe cache of 'metadata()' results (including absence of the file) with time to live.
+         * Entries are also invalidated by inotify(7): directory of every cached path is watched and
+         * events for the file drop its entry before TTL expires. If watch can't be added, only TTL is used.
+         */
+        class MetadataCache
+        {
+        private:
+            struct Impl;
+            std::unique_ptr<Impl> m_impl;
+
+        public:
+            explicit MetadataCache(std::chrono::milliseconds ttl = std::chrono::seconds(1));
+            MetadataCache(MetadataCache &&) noexcept;
+            MetadataCache &operator=(MetadataCache &&) noexcept;
+            ~MetadataCache();
+
+            std::optional<FileMetadata> get(std::filesystem::path const &path);
+            bool exists(std::filesystem::path const &path) { return get(path).has_value(); }
+            std::optional<std::uint64_t> size(std::filesystem::path const &path)
+            {
+                auto const m{get(path)};
+                return m ? std::optional<std::uint64_t>(m->size) : std::nullopt;
+            }
+
+            /// @brief Drops cached entry of the 'path'
+            void invalidate(std::filesystem::path const &path);
+
+            /// @brief Drops all entries and watches
+            void clear();
+        };
+
         /**
          * @brief Collect all filenames with specified mask into a vector
          * @param path path where to search
@@ -972,6 +4997,73 @@ namespace lvt
         std::vector<std::string> getFilenamesByMaskInDirsAndSubdirs(
             std::filesystem::path const &path = std::filesystem::current_path(),
             std::string const &mask = ".*\\.txt$");
+
+        /**
+         * @brief Shell-like wildcard pattern, compiled once and matched without backtracking explosion.
+         * Supports '*' (any sequence), '?' (any single character), "[abc]", "[a-z]", "[!a-z]" (or "[^a-z]")
+         * and '\' to escape the next character. Pattern is matched against the whole string.
+         */
+        class GlobPattern
+        {
+        private:
+            enum class Kind : std::uint8_t
+            {
+                Char,
+                Any,
+                Star,
+                Set
+            };
+
+            struct Token
+            {
+                Kind kind;
+                char ch;           // Character for 'Kind::Char'
+                std::uint16_t set; // Index in 'm_sets' for 'Kind::Set'
+            };
+
+            std::vector<Token> m_tokens;
+            std::vector<std::array<bool, 256ul>> m_sets;
+            std::string m_suffix; // Not empty if pattern is "*<literal>": matching is a single comparison
+            bool m_suffixOnly{false};
+
+        public:
+            /// @throw std::invalid_argument if pattern has unclosed '[' or trailing '\'
+            explicit GlobPattern(std::string_view pattern);
+
+            bool match(std::string_view str) const noexcept;
+        };
+
+        /// @brief How directory walker treats symbolic links
+        enum class SymlinkPolicy
+        {
+            Skip,        // Symbolic links are ignored
+            ReportFiles, // Links to regular files are reported, links to directories aren't entered
+            Follow       // Links are followed, every directory is entered once (protection from cycles)
+        };
+
+        struct WalkOptions
+        {
+            int maxDepth{-1}; // -1 - unlimited, 0 - only the entries of the root directory
+            SymlinkPolicy symlinks{SymlinkPolicy::ReportFiles};
+            unsigned threads{std::thread::hardware_concurrency()};
+        };
+
+        /**
+         * @brief Walks directory tree in parallel and calls 'fn(path, filename)' for every regular file.
+         * Directories are distributed among threads by per-thread queues with work stealing.
+         * Entries are read by getdents64(2) and their types are taken from 'd_type', so there is no 'stat'
+         * per entry (except for file systems that don't fill 'd_type' and for symbolic links).
+         * @note 'fn' is called concurrently from different threads, views are valid only during the call.
+         * Directories that can't be opened (i.e. permission denied) are skipped.
+         * @throw std::system_error if 'root' can't be opened. Exception thrown by 'fn' stops the walk and is rethrown.
+         */
+        void walkDirectory(std::filesystem::path const &root,
+                           std::function<void(std::string_view path, std::string_view filename)> const &fn,
+                           WalkOptions const &options = {});
+
+        /// @brief Full paths of all regular files in 'root' and its subdirectories matching 'glob', sorted
+        std::vector<std::string> findFiles(std::filesystem::path const &root, GlobPattern const &glob,
+                                           WalkOptions const &options = {});
     }
 }
 
@@ -37,83 +37,6 @@ concept Printable = requires(T a, std::ostream &os) {
 template <typename R, typename T>
 concept Matrix = std::convertible_to<std::ranges::range_reference_t<std::ranges::range_reference_t<R>>, T>;
 
-template <typename T>
-void printVec(std::vector<T> const &vec)
-{
-    for (const auto &el : vec)
-        std::cout << el << ' ';
-    endl(std::cout);
-}
-
-template <typename T>
-void print_range(std::span<const T> __range)
-{
-    for (const auto &el : __range)
-        std::cout << el << ' ';
-    endl(std::cout);
-}
-
-template <typename Iter>
-void print_range(Iter begin, Iter end)
-{
-    for (auto iter{begin}; iter != end; ++iter)
-        std::cout << *iter << ' ';
-    endl(std::cout);
-}
-
-template <typename T>
-void printMatrix(std::vector<std::vector<T>> const &matrix)
-{
-    for (size_t row{}; row < matrix.size(); row++)
-    {
-        for (size_t col{}; col < matrix.at(row).size(); col++)
-            std::cout << matrix.at(row).at(col) << '\t';
-        std::endl(std::cout);
-    }
-}
-
-/**
- * @brief Prints matrix
- * @tparam matrix matrix to print
- */
-template <Printable T>
-void printMatrix(Matrix<T> auto const &matrix)
-{
-    for (size_t i{}; i < matrix.size(); i++)
-    {
-        for (size_t j{}; j < matrix[i].size(); j++)
-            std::cout << matrix[i][j] << ' ';
-        std::endl(std::cout);
-    }
-}
-
-template <typename T1, typename T2>
-void print_pair_vec(const std::vector<std::pair<T1, T2>> &__vec)
-{
-    for (size_t index{0UL}; index < __vec.size(); index++)
-    {
-        std::cout << "array[" << __vec.at(index).first << "] = " << __vec.at(index).second << std::endl;
-    }
-}
-
-template <typename T1, typename T2>
-void print_dictionary(const std::map<T1, T2> &__dictionary)
-{
-    for (const auto &pair : __dictionary)
-    {
-        std::cout << pair.first << " - " << pair.second << '\n';
-    }
-}
-
-template <typename TupleType, size_t TupleSize>
-void printTuple(const TupleType &t)
-{
-    if constexpr (TupleSize > 1)
-        printTuple<TupleType, TupleSize - 1>(t);
-
-    std::cout << std::get<TupleSize - 1>(t) << std::endl;
-}
-
 template <typename T>
 bool is_equal(const T &__num1, const T &__num2)
 {
@@ -132,242 +55,200 @@ bool is_bigger(const T &__num1, const T &__num2)
     return (__num1 > __num2) ? true : false;
 }
 
-bool is_uint_number(const std::string &__str)
+template <typename T>
+consteval bool isArithmeticType([[maybe_unused]] const T &val) noexcept
 {
-    // Iterator for '__str' variable
-    std::string::const_iterator it = __str.begin();
-
-    // Using 'while' loop to check if all symbols in string are digits
-    while (it != __str.end() && std::isdigit(*it))
-    {
-        // Incrementing iterator
-        ++it;
-    }
-
-    return ((!__str.empty()) && (it == __str.end()));
+    if constexpr (std::is_integral_v<T> || std::is_signed_v<T> ||
+                  std::is_unsigned_v<T> || std::is_floating_point_v<T>)
+        return true;
+    return false;
 }
 
-bool is_int_number(const std::string &__str)
+namespace lvt::convert
 {
-    // Iterator for '__str' variable
-    std::string::const_iterator it = __str.begin();
-
-    unsigned int minus_count{0U};
-
-    // Iterating by symbols in string
-    // If symbol is minus -> incrementing counter of minuses
-    while (it != __str.end() && (*it == '-'))
-    {
-        minus_count++;
+    // 'std::int8_t' and 'std::uint8_t' are numbers too, only 'bool' and character types aren't
+    template <typename T>
+    concept CharconvNumber = std::is_floating_point_v<T> ||
+                             (std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char> &&
+                              !std::is_same_v<T, wchar_t> && !std::is_same_v<T, char8_t> && !std::is_same_v<T, char16_t> &&
+                              !std::is_same_v<T, char32_t>);
 
-        // Moving to next symbol
-        ++it;
-    }
-
-    // Move iterator in the beginning of string
-    it = __str.begin();
-
-    if (minus_count <= 1U)
+    namespace detail
     {
-        // Using 'while' loop to check if all symbols in string are digits
-        while (it != __str.end() && (std::isdigit(*it) || (*it == '-')))
+        // Returns true if all of the 8 bytes are ASCII digits
+        constexpr bool isEightDigits(std::uint64_t chunk) noexcept
         {
-            // Incrementing iterator
-            ++it;
+            return ((chunk & 0xF0F0F0F0F0F0F0F0ull) | (((chunk + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4ull)) ==
+                   0x3333333333333333ull;
         }
-    }
 
-    return ((!__str.empty()) && (it == __str.end()));
-}
-
-bool is_floating_number(const std::string &__str)
-{
-    // Iterator for '__str' variable
-    std::string::const_iterator it = __str.begin();
-
-    // Count of points in string (must be 1 point in number)
-    // Same thing with minus sign
-    unsigned int count_point{0U}, count_minus{0U};
-
-    // Iterating by symbols in string
-    while (it != __str.end())
-    {
-        // Counting all minuses in string
-        if ((*it == '-'))
-            count_minus++;
+        // Value of 8 ASCII digits loaded in little-endian order, digits are combined pairwise by 3 multiplications
+        constexpr std::uint32_t parseEightDigits(std::uint64_t chunk) noexcept
+        {
+            chunk -= 0x3030303030303030ull;
+            chunk = (chunk * 10ull) + (chunk >> 8ull);
+            chunk = (((chunk & 0x000000FF000000FFull) * (100ull + (1000000ull << 32ull))) +
+                     (((chunk >> 16ull) & 0x000000FF000000FFull) * (1ull + (10000ull << 32ull)))) >>
+                    32ull;
+            return static_cast<std::uint32_t>(chunk);
+        }
 
-        // Counting all points in string
-        if ((*it == '.'))
-            count_point++;
+        /**
+         * @brief Parses decimal digits from 'first' while they fit into 64 bits
+         * @return pointer past the last digit, nullptr on overflow
+         */
+        inline char const *parseDigits(char const *first, char const *last, std::uint64_t &value) noexcept
+        {
+            value = 0ull;
+            char const *const start{first};
+            if constexpr (std::endian::native == std::endian::little)
+            {
+                // 16 digits always fit into 64 bits, so first two chunks don't need the overflow checks
+                for (int chunks{}; chunks < 2 && last - first >= 8; ++chunks)
+                {
+                    std::uint64_t chunk;
+                    std::memcpy(&chunk, first, sizeof(chunk));
+                    if (!isEightDigits(chunk))
+                        break;
+                    value = value * 100000000ull + parseEightDigits(chunk);
+                    first += 8;
+                }
+            }
+            // Any 19 digits fit into 64 bits too
+            for (char const *const unchecked{first + std::min(last - first, 19l - (first - start))};
+                 first < unchecked && static_cast<unsigned char>(*first - '0') < 10u; ++first)
+                value = value * 10ull + static_cast<std::uint64_t>(*first - '0');
+            for (; first != last && static_cast<unsigned char>(*first - '0') < 10u; ++first)
+                if (__builtin_mul_overflow(value, 10ull, &value) ||
+                    __builtin_add_overflow(value, static_cast<std::uint64_t>(*first - '0'), &value))
+                    return nullptr;
+            return first;
+        }
 
-        // Incrementing iterator
-        ++it;
+        constexpr bool isSpace(char ch) noexcept { return ch == ' ' || (ch >= '\t' && ch <= '\r'); }
     }
 
-    // Exception case when point stay in the beginning of string
-    if (__str.at(0UL) == '.')
-        return false;
-
-    // Moving iterator to the begin of string
-    it = __str.begin();
-
-    // If number contains less or 1 point or minus -> continue
-    if (count_point <= 1U && count_minus <= 1U)
+    template <typename T>
+    std::expected<T, std::errc> fromString(std::string_view str) noexcept(CharconvNumber<T>)
     {
-        // Using 'while' loop to check if all symbols in string are digits
-        while (it != __str.end() && (std::isdigit(*it) || (*it) == '.' || (*it) == '-'))
+        // Surrounding whitespace and leading '+' are accepted as 'operator>>' does
+        if (!str.empty() && (str.front() <= ' ' || str.back() <= ' '))
         {
-            // Incrementing iterator
-            ++it;
+            while (!str.empty() && detail::isSpace(str.front()))
+                str.remove_prefix(1ul);
+            while (!str.empty() && detail::isSpace(str.back()))
+                str.remove_suffix(1ul);
         }
-    }
-
-    return ((!__str.empty()) && (it == __str.end()));
-}
 
-template <typename T>
-consteval bool isArithmeticType([[maybe_unused]] const T &val) noexcept
-{
-    if constexpr (std::is_integral_v<T> || std::is_signed_v<T> ||
-                  std::is_unsigned_v<T> || std::is_floating_point_v<T>)
-        return true;
-    return false;
-}
-
-template <typename T>
-T str_to_T(const std::string &__str)
-{
-    T value;
-    std::istringstream iss(__str);
-    iss >> value;
-    return value;
-}
+        if constexpr (CharconvNumber<T>)
+        {
+            char const *first{str.data()}, *const last{str.data() + str.size()};
+            bool const negative{first != last && *first == '-'};
+            if (first != last && (*first == '+' || negative))
+                ++first;
+            if (first == last || *first == '+' || *first == '-' || (negative && std::is_unsigned_v<T>))
+                return std::unexpected(std::errc::invalid_argument);
+
+            // Digit by digit parsing of 'std::from_chars' is as fast for the short numbers
+            if constexpr (std::is_integral_v<T> && sizeof(T) <= sizeof(std::uint64_t))
+            {
+                if (last - first >= 8)
+                {
+                    std::uint64_t magnitude;
+                    char const *const end{detail::parseDigits(first, last, magnitude)};
+                    if (end == nullptr)
+                        return std::unexpected(std::errc::result_out_of_range);
+                    if (end != last)
+                        return std::unexpected(std::errc::invalid_argument);
+
+                    std::uint64_t const limit{static_cast<std::uint64_t>(std::numeric_limits<T>::max()) + (negative ? 1ull : 0ull)};
+                    if (magnitude > limit)
+                        return std::unexpected(std::errc::result_out_of_range);
+                    return negative ? static_cast<T>(0ull - magnitude) : static_cast<T>(magnitude);
+                }
+            }
 
-template <typename T>
-std::vector<T> matrixToArr(std::vector<std::vector<T>> const &matrix)
-{
-    std::vector<T> arr(matrix.size() * matrix.at(0).size());
-    size_t idx{};
-    for (size_t row{}; row < matrix.size(); row++)
-    {
-        for (size_t col{}; col < matrix.at(row).size(); col++)
+            T value{};
+            auto const [ptr, ec]{std::from_chars(negative ? first - 1 : first, last, value)};
+            if (ec != std::errc{})
+                return std::unexpected(ec);
+            if (ptr != last)
+                return std::unexpected(std::errc::invalid_argument);
+            return value;
+        }
+        else if constexpr (std::is_constructible_v<T, std::string_view>)
+            return T(str);
+        else
         {
-            arr.at(idx) = matrix.at(row).at(col);
-            idx++;
+            T value{};
+            std::istringstream iss{std::string(str)};
+            if (!(iss >> value) || !(iss >> std::ws).eof())
+                return std::unexpected(std::errc::invalid_argument);
+            return value;
         }
     }
-    return arr;
-}
 
-template <typename T>
-std::string T_to_str(const T &__value)
-{
-    std::ostringstream oss;
-    oss << __value;
-    return oss.str();
-}
+    template <typename T>
+    T str_to_T(const std::string &str) { return fromString<T>(str).value_or(T{}); }
 
-template <typename T>
-std::vector<std::vector<T>> arrToMatrix(std::vector<T> const &arr, size_t rows, size_t cols)
-{
-    if (arr.size() != rows * cols)
+    template <typename T>
+    char *toChars(char *first, char *last, T const &value) noexcept
     {
-        std::cout << "The size of array and matrix don't match. Returning empty matrix..." << std::endl;
-        return std::vector<std::vector<T>>{{}};
+        auto const result{std::to_chars(first, last, value)};
+        return result.ec == std::errc{} ? result.ptr : nullptr;
     }
 
-    std::vector<std::vector<T>> matrix(rows, std::vector<T>(cols));
-    size_t idx{};
-    for (size_t row{}; row < rows && (idx < arr.size()); row++)
+    template <typename T>
+    std::string toString(T const &value)
     {
-        for (size_t col{}; col < cols; col++)
+        if constexpr (CharconvNumber<T>)
         {
-            matrix.at(row).at(col) = arr.at(idx);
-            idx++;
+            // Enough for the shortest representation of any floating point number including 'long double'
+            std::array<char, 64ul> buffer;
+            return std::string(buffer.data(), toChars(buffer.data(), buffer.data() + buffer.size(), value));
         }
-    }
-    return matrix;
-}
-
-template <typename T>
-T input_to_uint(const char *__msg)
-{
-    // User's input string
-    std::string users_input{};
-
-    // Using 'while' loop and string input to avoid errors
-    while (true)
-    {
-        std::cout << __msg;
-        std::cin >> users_input;
-
-        // If 'input' is contains only of digits -> break infinity loop
-        if (is_uint_number(users_input))
-            break;
-        // Else: print message and back to the begininng of 'while' loop
+        else if constexpr (std::is_convertible_v<T const &, std::string_view>)
+            return std::string(std::string_view(value));
         else
-            std::cout << "You entered not an unsigned integer number. Try again.\n";
+        {
+            std::ostringstream oss;
+            oss << value;
+            return oss.str();
+        }
     }
 
-    // Converting user's string to numeric type to return it as a result
-    T num{str_to_T<T>(users_input)};
-
-    // Returning converted user's inputted value to 'T' type
-    return num;
+    template <typename T>
+    std::string T_to_str(const T &value) { return toString(value); }
 }
 
 template <typename T>
-T input_to_int(const char *__msg)
+std::vector<T> matrixToArr(std::vector<std::vector<T>> const &matrix)
 {
-    // User's input string
-    std::string users_input{};
-
-    // Using 'while' loop and string input to avoid errors
-    while (true)
-    {
-        std::cout << __msg;
-        std::cin >> users_input;
-
-        // If 'input' is contains only of digits -> break infinity loop
-        if (is_int_number(users_input))
-            break;
-        // Else: print message and back to the begininng of 'while' loop
-        else
-            std::cout << "You entered not an signed integer number. Try again.\n";
-    }
-
-    // Converting user's string to numeric type to return it as a result
-    T num{str_to_T<T>(users_input)};
+    std::vector<T> arr;
+    arr.reserve(matrix.size() * (matrix.empty() ? 0ul : matrix.front().size()));
 
-    // Returning converted user's inputted value to 'T' type
-    return num;
+    // Appending rows one by one as a whole ranges
+    for (auto const &row : matrix)
+        arr.insert(arr.end(), row.cbegin(), row.cend());
+    return arr;
 }
 
 template <typename T>
-T input_to_floating(const char *__msg)
+std::vector<std::vector<T>> arrToMatrix(std::vector<T> const &arr, size_t rows, size_t cols)
 {
-    // User's input string
-    std::string users_input{};
-
-    // Using 'while' loop and string input to avoid errors
-    while (true)
+    if (arr.size() != rows * cols)
     {
-        std::cout << __msg;
-        std::cin >> users_input;
-
-        // If 'input' is contains only of digits -> break infinity loop
-        if (is_floating_number(users_input))
-            break;
-        // Else: print message and back to the begininng of 'while' loop
-        else
-            std::cout << "You entered not an floating number. Try again.\n";
+        std::cout << "The size of array and matrix don't match. Returning empty matrix..." << std::endl;
+        return std::vector<std::vector<T>>{{}};
     }
 
-    // Converting user's string to numeric type to return it as a result
-    T num{str_to_T<T>(users_input)};
+    std::vector<std::vector<T>> matrix;
+    matrix.reserve(rows);
 
-    // Returning converted user's inputted value to 'T' type
-    return num;
+    // Constructing each row from the corresponding part of the array
+    for (size_t row{}; row < rows; row++)
+        matrix.emplace_back(arr.cbegin() + row * cols, arr.cbegin() + (row + 1ul) * cols);
+    return matrix;
 }
 
 template <typename T>
@@ -1123,33 +1004,16 @@ constexpr std::vector<T> getUniqueElementsFromTwoSequences(std::span<T const> ra
 template <std::integral T>
 constexpr std::vector<T> sumOfPolynomials(std::span<T const> a, std::span<T const> b)
 {
-    std::vector<T> minSizeArr, maxSizeArr, result;
-
-    // Determining arrays with the minimal and maximal sizes
-    if (a.size() > b.size())
-    {
-        minSizeArr.assign(b.begin(), b.end());
-        maxSizeArr.assign(a.begin(), a.end());
-    }
-    else
-    {
-        minSizeArr.assign(a.begin(), a.end());
-        maxSizeArr.assign(b.begin(), b.end());
-    }
-
-    // Reversing order of the coefs
-    std::ranges::reverse(minSizeArr);
-    std::ranges::reverse(maxSizeArr);
-
-    // Add space to the result array
-    result.resize(maxSizeArr.size());
+    // Making the longer polynomial to be the first one
+    if (a.size() < b.size())
+        std::swap(a, b);
 
-    // Summation of the coefs
-    for (size_t i{}; i < maxSizeArr.size(); i++)
-        (i < minSizeArr.size()) ? result.at(i) = minSizeArr.at(i) + maxSizeArr.at(i) : result.at(i) = maxSizeArr.at(i);
+    // Coefficients are aligned by the lowest degree: b[j] is added to a[j + offset]
+    std::vector<T> result(a.begin(), a.end());
+    size_t const offset{a.size() - b.size()};
+    for (size_t j{}; j < b.size(); j++)
+        result[offset + j] += b[j];
 
-    // Bringing result polynomial to the correct order
-    std::ranges::reverse(result);
     return result;
 }
 